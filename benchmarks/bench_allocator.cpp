@@ -1,9 +1,24 @@
 #include <benchmark/benchmark.h>
 
 #include <hpc/core/arena_allocator.hpp>
+#include <hpc/core/buddy_allocator.hpp>
+#include <hpc/core/concurrent_arena.hpp>
+#include <hpc/core/frame_arena.hpp>
 #include <hpc/core/pool_allocator.hpp>
+#include <hpc/core/ring_buffer.hpp>
+#include <hpc/core/shared_buffer_pool.hpp>
+#include <hpc/core/tlsf_allocator.hpp>
+#include <hpc/core/ttas_spinlock.hpp>
+#include <hpc/support/clock.hpp>
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -52,9 +67,404 @@ void BM_PoolAlloc(benchmark::State& state)
     state.SetItemsProcessed(state.iterations() * state.range(0));
 }
 
+// Parallel-phase scratch allocation: 64-byte objects from one shared arena,
+// either through per-thread chunks or a spinlock around a plain arena. Each
+// run is one phase with a fixed iteration count, so neither arena needs a
+// reset mid-run; both are pre-faulted once so page faults are not measured.
+constexpr std::size_t kScratchPerRound = 256;
+constexpr std::size_t kScratchArenaBytes = std::size_t{256} << 20;
+constexpr benchmark::IterationCount kScratchRounds = 2000;
+
+void BM_ScratchAlloc_LockedArena(benchmark::State& state)
+{
+    static hpc::core::arena arena = [] {
+        hpc::core::arena a(kScratchArenaBytes);
+        std::memset(a.data(), 0, a.capacity());
+        return a;
+    }();
+    static hpc::core::ttas_spinlock lock;
+    if (state.thread_index() == 0) {
+        arena.reset();
+    }
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kScratchPerRound; ++i) {
+            lock.lock();
+            void* p = arena.allocate(sizeof(payload), alignof(payload));
+            lock.unlock();
+            benchmark::DoNotOptimize(p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kScratchPerRound));
+}
+
+void BM_ScratchAlloc_ConcurrentArena(benchmark::State& state)
+{
+    static hpc::core::concurrent_arena arena(kScratchArenaBytes);
+    static const bool prefaulted = [] {
+        hpc::core::concurrent_arena::thread_cache cache(arena);
+        std::memset(cache.allocate(kScratchArenaBytes, 1), 0, kScratchArenaBytes);
+        return true;
+    }();
+    benchmark::DoNotOptimize(prefaulted);
+    if (state.thread_index() == 0) {
+        arena.reset();
+    }
+    hpc::core::concurrent_arena::thread_cache cache(arena);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kScratchPerRound; ++i) {
+            void* p = cache.allocate(sizeof(payload), alignof(payload));
+            benchmark::DoNotOptimize(p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kScratchPerRound));
+}
+
+// One event-loop tick: allocate 512 temporaries that must survive one more
+// tick, then drop the previous tick's set. malloc pays for every free;
+// frame_arena drops a whole frame with one reset.
+constexpr std::size_t kTickObjects = 512;
+
+void BM_TickAlloc_Malloc(benchmark::State& state)
+{
+    std::vector<void*> previous(kTickObjects, nullptr);
+    std::vector<void*> current(kTickObjects, nullptr);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kTickObjects; ++i) {
+            current[i] = std::malloc(sizeof(payload));
+            benchmark::DoNotOptimize(current[i]);
+        }
+        for (void* p : previous) {
+            std::free(p);
+        }
+        std::swap(previous, current);
+    }
+    for (void* p : previous) {
+        std::free(p);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kTickObjects));
+}
+
+void BM_TickAlloc_FrameArena(benchmark::State& state)
+{
+    hpc::core::frame_arena frames(kTickObjects * sizeof(payload), 2);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < kTickObjects; ++i) {
+            void* p = frames.allocate(sizeof(payload), alignof(payload));
+            benchmark::DoNotOptimize(p);
+        }
+        frames.advance_frame();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kTickObjects));
+}
+
+// Groups of range(0) objects, one call per object vs one splice per group.
+void BM_PoolAllocGroup_Single(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    hpc::core::fixed_pool pool(sizeof(payload), 1 << 12);
+    std::vector<void*> group(n);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < n; ++i) {
+            group[i] = pool.allocate();
+        }
+        benchmark::DoNotOptimize(group.data());
+        for (std::size_t i = 0; i < n; ++i) {
+            pool.deallocate(group[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PoolAllocGroup_Bulk(benchmark::State& state)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    hpc::core::fixed_pool pool(sizeof(payload), 1 << 12);
+    std::vector<void*> group(n);
+
+    for (auto _ : state) {
+        pool.allocate_bulk(group.data(), n);
+        benchmark::DoNotOptimize(group.data());
+        pool.deallocate_bulk(group.data(), n);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Remote return of range(0) shared buffers: one CAS each vs one per batch.
+// Ownership is handed to a thread that exits at once, so every release here
+// takes the remote-free path; allocate_bulk then reclaims them in one swap.
+void shared_release_round(benchmark::State& state, bool batched)
+{
+    const auto n = static_cast<std::size_t>(state.range(0));
+    hpc::core::shared_buffer_pool pool(256, n);
+    std::thread([&pool] { pool.adopt(); }).join();
+    std::vector<hpc::core::buffer_handle> group(n);
+
+    for (auto _ : state) {
+        pool.allocate_bulk(group.data(), n);
+        if (batched) {
+            hpc::core::shared_buffer_pool::release(std::span<const hpc::core::buffer_handle>(group));
+        } else {
+            for (auto h : group) {
+                hpc::core::shared_buffer_pool::release(h);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SharedRelease_Single(benchmark::State& state) { shared_release_round(state, false); }
+void BM_SharedRelease_Batch(benchmark::State& state) { shared_release_round(state, true); }
+
+// Walk the header line of many 4 KiB pool objects, as a hash table or order
+// book sweep would. Uncolored, every header maps to the same L1 set (and a
+// handful of L2 sets); with slab coloring they spread across the cache.
+struct page_object {
+    std::uint64_t key;
+    std::uint64_t value;
+    std::byte body[4096 - 16];
+};
+
+void pool_header_sweep(benchmark::State& state, hpc::core::fixed_pool& pool)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<page_object*> objects;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto* o = ::new (pool.allocate()) page_object;
+        o->key = i;
+        o->value = i * 3;
+        objects.push_back(o);
+    }
+
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (page_object* o : objects) {
+            sum += o->key ^ o->value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PoolSweep_Uncolored(benchmark::State& state)
+{
+    hpc::core::fixed_pool pool(sizeof(page_object), static_cast<std::size_t>(state.range(0)));
+    pool_header_sweep(state, pool);
+}
+
+void BM_PoolSweep_Colored(benchmark::State& state)
+{
+    hpc::core::fixed_pool pool(sizeof(page_object), static_cast<std::size_t>(state.range(0)),
+                               hpc::core::pool_coloring{1});
+    pool_header_sweep(state, pool);
+}
+
+// Mixed 4 KiB .. 1 MiB buffers, allocated in groups of 16 and freed again:
+// the buddy allocator recycles huge-page blocks, malloc serves the larger
+// sizes with fresh mmap/munmap calls.
+constexpr std::size_t kLargeSizes[] = {4096, 12000, 65536, 200000, 1u << 20, 8192, 300000, 40000};
+
+void BM_MallocLarge(benchmark::State& state)
+{
+    void* live[16];
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < 16; ++i) {
+            live[i] = std::malloc(kLargeSizes[i % std::size(kLargeSizes)]);
+            benchmark::DoNotOptimize(live[i]);
+        }
+        for (void* p : live) {
+            std::free(p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+
+void BM_BuddyAllocLarge(benchmark::State& state)
+{
+    hpc::core::buddy_allocator buddy(std::size_t{64} << 20);
+    void* live[16];
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < 16; ++i) {
+            live[i] = buddy.allocate(kLargeSizes[i % std::size(kLargeSizes)]);
+            benchmark::DoNotOptimize(live[i]);
+        }
+        for (void* p : live) {
+            buddy.deallocate(p);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+
+// Adversarial mixed workload for worst-case latency: small blocks
+// interleaved with occasional large ones, freed in random order so the free
+// space splinters, then refilled with sizes that fit none of the holes. Every
+// operation is timed individually; max and p99.9 matter, not the mean.
+struct latency_op {
+    std::size_t bytes; // 0 = free live[slot]
+    std::size_t slot;
+};
+
+std::vector<latency_op> make_adversarial_ops()
+{
+    constexpr std::size_t kSlots = 4096;
+    std::mt19937 rng(1234);
+    std::vector<latency_op> ops;
+    std::vector<bool> used(kSlots, false);
+    for (std::size_t i = 0; i < 200000; ++i) {
+        const std::size_t slot = rng() % kSlots;
+        if (used[slot]) {
+            ops.push_back({0, slot});
+        } else {
+            const std::size_t phase = (i / 20000) % 2;
+            const std::size_t bytes = rng() % 64 == 0 ? 64 * 1024 + rng() % (512 * 1024)
+                                    : phase == 0   ? 16 + rng() % 240
+                                                   : 300 + rng() % 3000;
+            ops.push_back({bytes, slot});
+        }
+        used[slot] = !used[slot];
+    }
+    return ops;
+}
+
+template <class Alloc, class Free>
+void run_latency(benchmark::State& state, Alloc&& alloc, Free&& release)
+{
+    static const std::vector<latency_op> ops = make_adversarial_ops();
+    std::vector<void*> live(4096, nullptr);
+    std::vector<std::uint64_t> samples(ops.size());
+    std::uint64_t worst = 0;
+
+    // One untimed pass first, so page faults on fresh memory are not
+    // charged to either allocator.
+    for (const latency_op& op : ops) {
+        if (op.bytes == 0) {
+            release(live[op.slot]);
+            live[op.slot] = nullptr;
+        } else {
+            live[op.slot] = alloc(op.bytes);
+        }
+    }
+    for (void*& p : live) {
+        release(p);
+        p = nullptr;
+    }
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < ops.size(); ++i) {
+            const latency_op& op = ops[i];
+            const auto start = hpc::support::clock::now();
+            if (op.bytes == 0) {
+                release(live[op.slot]);
+                live[op.slot] = nullptr;
+            } else {
+                live[op.slot] = alloc(op.bytes);
+            }
+            samples[i] = hpc::support::to_nanoseconds(hpc::support::clock::now() - start);
+            benchmark::DoNotOptimize(live[op.slot]);
+        }
+        for (void*& p : live) {
+            release(p);
+            p = nullptr;
+        }
+        worst = std::max(worst, *std::max_element(samples.begin(), samples.end()));
+    }
+
+    std::sort(samples.begin(), samples.end());
+    state.counters["p50_ns"] = static_cast<double>(samples[samples.size() / 2]);
+    state.counters["p999_ns"] = static_cast<double>(samples[samples.size() * 999 / 1000]);
+    state.counters["p9999_ns"] = static_cast<double>(samples[samples.size() * 9999 / 10000]);
+    state.counters["max_ns"] = static_cast<double>(worst);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ops.size()));
+}
+
+void BM_Latency_Malloc(benchmark::State& state)
+{
+    run_latency(state, [](std::size_t n) { return std::malloc(n); }, [](void* p) { std::free(p); });
+}
+
+void BM_Latency_Tlsf(benchmark::State& state)
+{
+    hpc::core::tlsf_allocator tlsf(std::size_t{1} << 30);
+    run_latency(state,
+                [&](std::size_t n) { return tlsf.allocate(n); },
+                [&](void* p) { tlsf.deallocate(p); });
+}
+
+// Fan one 4 KiB payload out to four consumers: copy it into each ring, or
+// push an 8-byte handle with a fan-out refcount and release on consumption.
+constexpr std::size_t kFanOut = 4;
+constexpr std::size_t kFanOutPayload = 4096;
+
+struct large_message {
+    std::byte bytes[kFanOutPayload];
+};
+
+void BM_FanOut_CopyPayload(benchmark::State& state)
+{
+    std::deque<hpc::core::spsc_ring_buffer<large_message>> rings;
+    for (std::size_t i = 0; i < kFanOut; ++i) {
+        rings.emplace_back(64);
+    }
+    large_message msg{};
+    large_message out{};
+
+    for (auto _ : state) {
+        msg.bytes[0] = std::byte{1};
+        for (auto& ring : rings) {
+            ring.try_push(msg);
+        }
+        for (auto& ring : rings) {
+            ring.try_pop(out);
+            benchmark::DoNotOptimize(out.bytes[0]);
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kFanOutPayload));
+}
+
+void BM_FanOut_SharedHandle(benchmark::State& state)
+{
+    hpc::core::shared_buffer_pool pool(kFanOutPayload, 64);
+    std::deque<hpc::core::spsc_ring_buffer<hpc::core::buffer_handle>> rings;
+    for (std::size_t i = 0; i < kFanOut; ++i) {
+        rings.emplace_back(64);
+    }
+    hpc::core::buffer_handle out;
+
+    for (auto _ : state) {
+        hpc::core::buffer_handle h = pool.allocate(kFanOut);
+        h.data()[0] = std::byte{1};
+        for (auto& ring : rings) {
+            ring.try_push(h);
+        }
+        for (auto& ring : rings) {
+            ring.try_pop(out);
+            benchmark::DoNotOptimize(out.data()[0]);
+            hpc::core::shared_buffer_pool::release(out);
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kFanOutPayload));
+}
+
 } // namespace
 
 BENCHMARK(BM_Malloc)->Arg(1 << 10);
 BENCHMARK(BM_ArenaAlloc)->Arg(1 << 10);
 BENCHMARK(BM_PoolAlloc)->Arg(1 << 10);
-
+BENCHMARK(BM_ScratchAlloc_LockedArena)->Iterations(kScratchRounds)->Threads(1)->Threads(4);
+BENCHMARK(BM_ScratchAlloc_ConcurrentArena)->Iterations(kScratchRounds)->Threads(1)->Threads(4);
+BENCHMARK(BM_TickAlloc_Malloc);
+BENCHMARK(BM_TickAlloc_FrameArena);
+BENCHMARK(BM_PoolAllocGroup_Single)->Arg(32)->Arg(256);
+BENCHMARK(BM_PoolAllocGroup_Bulk)->Arg(32)->Arg(256);
+BENCHMARK(BM_SharedRelease_Single)->Arg(32)->Arg(256);
+BENCHMARK(BM_SharedRelease_Batch)->Arg(32)->Arg(256);
+BENCHMARK(BM_PoolSweep_Uncolored)->Arg(64)->Arg(512);
+BENCHMARK(BM_PoolSweep_Colored)->Arg(64)->Arg(512);
+BENCHMARK(BM_MallocLarge);
+BENCHMARK(BM_BuddyAllocLarge);
+BENCHMARK(BM_Latency_Malloc)->Iterations(5);
+BENCHMARK(BM_Latency_Tlsf)->Iterations(5);
+BENCHMARK(BM_FanOut_CopyPayload);
+BENCHMARK(BM_FanOut_SharedHandle);
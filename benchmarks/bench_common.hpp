@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+#include <hpc/support/cache_line.hpp>
+
+namespace hpc::bench {
+
+// Helpers shared by the queue benchmarks.
+
+// Fixed-size message used by the backlog benchmarks.
+template <std::size_t Bytes>
+struct alignas(hpc::support::cache_line_size) sized_message {
+    std::byte data[Bytes];
+};
+
+// Read one byte per cache line, standing in for a consumer that inspects the
+// whole message.
+template <std::size_t Bytes>
+std::size_t touch_lines(const sized_message<Bytes>& m) noexcept
+{
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < Bytes; i += hpc::support::cache_line_size) {
+        sum += static_cast<std::size_t>(m.data[i]);
+    }
+    return sum;
+}
+
+} // namespace hpc::bench
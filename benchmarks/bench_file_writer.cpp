@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <hpc/io/async_file_writer.hpp>
+
+namespace {
+
+// Journal-style workload: range(0)-byte records appended until 16 MiB have
+// been written, then made durable. Compares a blocking write(2) per record
+// against async_file_writer with io_uring and with its pwritev fallback.
+
+constexpr std::size_t journal_bytes = std::size_t{16} << 20;
+
+std::string bench_path()
+{
+    return (std::filesystem::temp_directory_path() / ("hpc_bench_journal_" + std::to_string(::getpid()))).string();
+}
+
+void BM_Journal_BlockingWrite(benchmark::State& state)
+{
+    const auto record_size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::byte> record(record_size, std::byte{0x5a});
+    const std::string path = bench_path();
+
+    for (auto _ : state) {
+        const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        for (std::size_t written = 0; written < journal_bytes; written += record_size) {
+            if (::write(fd, record.data(), record_size) < 0) {
+                state.SkipWithError("write failed");
+                break;
+            }
+        }
+        ::fdatasync(fd);
+        ::close(fd);
+    }
+
+    std::filesystem::remove(path);
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(journal_bytes));
+}
+
+// range(1): 0 = io_uring (when available), 1 = pwritev thread.
+void BM_Journal_AsyncWriter(benchmark::State& state)
+{
+    const auto record_size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::byte> record(record_size, std::byte{0x5a});
+    const std::string path = bench_path();
+
+    hpc::io::async_file_writer_config cfg{};
+    cfg.path = path;
+    cfg.force_fallback = state.range(1) != 0;
+
+    for (auto _ : state) {
+        hpc::io::async_file_writer w(cfg);
+        for (std::size_t written = 0; written < journal_bytes; written += record_size) {
+            w.append(record);
+        }
+        w.sync();
+    }
+
+    std::filesystem::remove(path);
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(journal_bytes));
+}
+
+} // namespace
+
+BENCHMARK(BM_Journal_BlockingWrite)->Arg(256)->Arg(4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Journal_AsyncWriter)
+    ->Args({256, 0})
+    ->Args({256, 1})
+    ->Args({4096, 0})
+    ->Args({4096, 1})
+    ->Unit(benchmark::kMillisecond);
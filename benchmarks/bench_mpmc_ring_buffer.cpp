@@ -1,10 +1,13 @@
 #include <benchmark/benchmark.h>
 
+#include "bench_common.hpp"
+
 #include <atomic>
 #include <thread>
 #include <vector>
 
 #include <hpc/core/mpmc_ring_buffer.hpp>
+#include <hpc/core/sequencer.hpp>
 #include <hpc/support/cpu_topology.hpp>
 
 #include <queue>
@@ -144,8 +147,85 @@ void BM_StdQueue_Mutex_Throughput(benchmark::State& state)
     }
 }
 
+using hpc::bench::sized_message;
+using hpc::bench::touch_lines;
+
+// Single consumer draining a 64 MiB backlog; range(0) is the prefetch
+// distance (0 disables it).
+template <std::size_t Bytes>
+void BM_MPMCQueue_DrainBacklog(benchmark::State& state)
+{
+    using message = sized_message<Bytes>;
+    const auto prefetch_distance = static_cast<std::size_t>(state.range(0));
+    hpc::core::mpmc_ring_buffer<message> q((std::size_t{64} << 20) / Bytes);
+    const message msg{};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        while (q.try_push_streaming(msg)) {
+        }
+        state.ResumeTiming();
+
+        std::size_t sum = 0;
+        q.drain([&sum](message& m) noexcept { sum += touch_lines(m); },
+                static_cast<std::size_t>(-1), prefetch_distance);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(q.capacity()));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(q.capacity() * Bytes));
+}
+
+
+// range(0) producers feeding one in-order consumer through the sequencer;
+// range(1) items in total.
+void BM_Sequencer_MultiProducer(benchmark::State& state)
+{
+    const auto producers = static_cast<std::size_t>(state.range(0));
+    const auto total_ops = static_cast<std::uint64_t>(state.range(1));
+
+    for (auto _ : state) {
+        hpc::core::sequencer<std::uint64_t> seq(1u << 14);
+
+        std::atomic<bool> start{false};
+        std::atomic<std::uint64_t> produced{0};
+
+        std::vector<std::thread> producer_threads;
+        producer_threads.reserve(producers);
+        for (std::size_t p = 0; p < producers; ++p) {
+            producer_threads.emplace_back([&]() {
+                while (!start.load(std::memory_order_acquire)) {
+                }
+                for (;;) {
+                    auto idx = produced.fetch_add(1, std::memory_order_relaxed);
+                    if (idx >= total_ops) break;
+                    seq.emplace(idx);
+                }
+            });
+        }
+
+        start.store(true, std::memory_order_release);
+
+        std::uint64_t consumed = 0;
+        std::uint64_t sum = 0;
+        while (consumed < total_ops) {
+            consumed += seq.drain([&sum](std::uint64_t, std::uint64_t& v) { sum += v; });
+        }
+        benchmark::DoNotOptimize(sum);
+
+        for (auto& t : producer_threads) t.join();
+
+        state.SetItemsProcessed(state.items_processed() + static_cast<std::int64_t>(total_ops));
+    }
+}
+
 } // namespace
 
+BENCHMARK_TEMPLATE(BM_MPMCQueue_DrainBacklog, 64)->Arg(0)->Arg(4)->Arg(16);
+BENCHMARK_TEMPLATE(BM_MPMCQueue_DrainBacklog, 256)->Arg(0)->Arg(4)->Arg(16);
+BENCHMARK_TEMPLATE(BM_MPMCQueue_DrainBacklog, 1024)->Arg(0)->Arg(2)->Arg(8);
+BENCHMARK_TEMPLATE(BM_MPMCQueue_DrainBacklog, 4096)->Arg(0)->Arg(1)->Arg(4);
+
 BENCHMARK(BM_MPMCQueue_Throughput)
     ->Args({2, 2, 1 << 20})
     ->Unit(benchmark::kNanosecond);
@@ -153,3 +233,7 @@ BENCHMARK(BM_MPMCQueue_Throughput)
 BENCHMARK(BM_StdQueue_Mutex_Throughput)
     ->Args({2, 2, 1 << 20})
     ->Unit(benchmark::kNanosecond);
+
+BENCHMARK(BM_Sequencer_MultiProducer)
+    ->Args({2, 1 << 20})
+    ->Unit(benchmark::kNanosecond);
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <hpc/core/numa_ring_buffer.hpp>
+#include <hpc/support/cpu_topology.hpp>
+
+namespace {
+
+// Cross-socket SPSC link: producer pinned to a core on node 0, consumer
+// pinned to a core on the last node. range(0) selects where the ring lives:
+//   0 = consumer-homed (ring bound to the consumer's node)
+//   1 = producer-homed (ring bound to the producer's node)
+// On single-node hosts both threads share node 0 and the two variants should
+// match; the label records which case ran.
+
+struct alignas(64) message {
+    std::uint64_t seq;
+    std::uint8_t  payload[56];
+};
+
+void BM_SPSCQueue_CrossSocket(benchmark::State& state)
+{
+    const bool consumer_homed = state.range(0) == 0;
+    const std::size_t messages = static_cast<std::size_t>(state.range(1));
+
+    const int nodes = hpc::support::numa_node_count();
+    const int producer_node = 0;
+    const int consumer_node = nodes - 1;
+    const auto producer_cores = hpc::support::cores_of_node(producer_node);
+    const auto consumer_cores = hpc::support::cores_of_node(consumer_node);
+
+    // Avoid pinning both threads to the same core on single-node hosts.
+    unsigned producer_core = producer_cores.empty() ? 0u : producer_cores.front();
+    unsigned consumer_core = consumer_cores.empty() ? 0u : consumer_cores.back();
+
+    const int home = consumer_homed ? consumer_node : producer_node;
+    hpc::core::numa_spsc_ring_buffer<message> q(1u << 12, home);
+
+    state.SetLabel(std::string(consumer_homed ? "consumer-homed" : "producer-homed")
+                   + (nodes > 1 ? "" : " (single node)")
+                   + (q.numa_node() == home ? "" : " (unbound)"));
+
+    for (auto _ : state) {
+        std::atomic<bool> start{false};
+
+        std::thread consumer([&]() {
+            while (!start.load(std::memory_order_acquire)) {
+            }
+            std::size_t received = 0;
+            std::uint64_t sum = 0;
+            while (received < messages) {
+                received += q.drain([&sum](message& m) { sum += m.seq; });
+            }
+            benchmark::DoNotOptimize(sum);
+        });
+        std::thread producer([&]() {
+            while (!start.load(std::memory_order_acquire)) {
+            }
+            message msg{};
+            for (std::size_t i = 0; i < messages; ++i) {
+                msg.seq = i;
+                while (!q.try_push(msg)) {
+                }
+            }
+        });
+
+        hpc::support::pin_thread_to_core(producer, producer_core);
+        hpc::support::pin_thread_to_core(consumer, consumer_core);
+
+        start.store(true, std::memory_order_release);
+        producer.join();
+        consumer.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(messages));
+}
+
+} // namespace
+
+BENCHMARK(BM_SPSCQueue_CrossSocket)
+    ->Args({0, 1 << 20})
+    ->Args({1, 1 << 20})
+    ->UseRealTime();
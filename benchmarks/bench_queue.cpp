@@ -1,10 +1,21 @@
 #include <benchmark/benchmark.h>
 
+#include "bench_common.hpp"
+
 #include <hpc/core/ring_buffer.hpp>
+#include <hpc/core/spsc_merge_consumer.hpp>
+#include <hpc/core/spsc_ring_group.hpp>
+#include <hpc/core/spsc_unbounded_queue.hpp>
+#include <hpc/support/cache_line.hpp>
 #include <hpc/support/cpu_topology.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <queue>
 #include <thread>
+#include <vector>
 
 namespace {
 
@@ -26,6 +37,22 @@ void BM_SPSCQueue_Throughput(benchmark::State& state)
     state.SetItemsProcessed(state.iterations() * state.range(0));
 }
 
+void BM_SPSCUnboundedQueue_Throughput(benchmark::State& state)
+{
+    hpc::core::spsc_unbounded_queue<std::uint64_t> q(1 << 12, 4, 1);
+
+    for (auto _ : state) {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(state.range(0)); ++i) {
+            q.push(value);
+            while (!q.try_pop(value)) {
+            }
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
 void BM_StdQueue_Throughput(benchmark::State& state)
 {
     std::queue<std::uint64_t> q;
@@ -42,8 +69,261 @@ void BM_StdQueue_Throughput(benchmark::State& state)
     state.SetItemsProcessed(state.iterations() * state.range(0));
 }
 
+using hpc::bench::sized_message;
+using hpc::bench::touch_lines;
+
+// Size the ring so a full backlog (64 MiB) is well beyond the LLC.
+template <std::size_t Bytes>
+constexpr std::size_t backlog_capacity = ((std::size_t{64} << 20) / Bytes) - 1;
+
+// Drain a full backlog; range(0) is the prefetch distance (0 disables it).
+template <std::size_t Bytes>
+void BM_SPSCQueue_DrainBacklog(benchmark::State& state)
+{
+    using message = sized_message<Bytes>;
+    const auto prefetch_distance = static_cast<std::size_t>(state.range(0));
+    hpc::core::spsc_ring_buffer<message> q(backlog_capacity<Bytes>);
+    const message msg{};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        while (q.try_push(msg)) {
+        }
+        state.ResumeTiming();
+
+        std::size_t sum = 0;
+        q.drain([&sum](message& m) { sum += touch_lines(m); },
+                static_cast<std::size_t>(-1), prefetch_distance);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(q.capacity()));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(q.capacity() * Bytes));
+}
+
+// Fill a backlog; range(0) selects regular (0) or non-temporal (1) stores.
+template <std::size_t Bytes>
+void BM_SPSCQueue_FillBacklog(benchmark::State& state)
+{
+    using message = sized_message<Bytes>;
+    const bool streaming = state.range(0) != 0;
+    hpc::core::spsc_ring_buffer<message> q(backlog_capacity<Bytes>);
+    const message msg{};
+
+    for (auto _ : state) {
+        if (streaming) {
+            while (q.try_push_streaming(msg)) {
+            }
+        } else {
+            while (q.try_push(msg)) {
+            }
+        }
+
+        state.PauseTiming();
+        q.drain([](message&) {});
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(q.capacity()));
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(q.capacity() * Bytes));
+}
+
+
+constexpr std::size_t sweep_ring_count = 2048;
+
+// One message into each of range(0) rings spread over the set, then one sweep
+// that probes every ring's indices.
+void BM_RingSweep_ProbeAll(benchmark::State& state)
+{
+    const auto active = static_cast<std::size_t>(state.range(0));
+    const std::size_t stride = sweep_ring_count / active;
+    std::vector<std::unique_ptr<hpc::core::spsc_ring_buffer<std::uint64_t>>> rings;
+    for (std::size_t i = 0; i < sweep_ring_count; ++i) {
+        rings.push_back(std::make_unique<hpc::core::spsc_ring_buffer<std::uint64_t>>(16));
+    }
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < sweep_ring_count; i += stride) {
+            rings[i]->try_push(i);
+        }
+        for (auto& ring : rings) {
+            if (!ring->empty()) {
+                ring->drain([&sum](std::uint64_t& v) { sum += v; });
+            }
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(active));
+}
+
+// Same workload through spsc_ring_group: the sweep visits only flagged rings.
+void BM_RingSweep_ActivityBitmap(benchmark::State& state)
+{
+    const auto active = static_cast<std::size_t>(state.range(0));
+    const std::size_t stride = sweep_ring_count / active;
+    hpc::core::spsc_ring_group<std::uint64_t> group(sweep_ring_count, 16);
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < sweep_ring_count; i += stride) {
+            group.try_push(i, i);
+        }
+        group.poll([&sum](std::size_t, std::uint64_t& v) { sum += v; });
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(active));
+}
+
+
+struct feed_tick {
+    std::uint64_t ts;
+    std::uint64_t payload;
+};
+
+struct feed_tick_time {
+    std::uint64_t operator()(const feed_tick& t) const noexcept { return t.ts; }
+};
+
+constexpr std::size_t merge_per_feed = 256;
+
+std::vector<std::unique_ptr<hpc::core::spsc_ring_buffer<feed_tick>>> make_feeds(std::size_t count)
+{
+    std::vector<std::unique_ptr<hpc::core::spsc_ring_buffer<feed_tick>>> feeds;
+    for (std::size_t i = 0; i < count; ++i) {
+        feeds.push_back(std::make_unique<hpc::core::spsc_ring_buffer<feed_tick>>(merge_per_feed));
+    }
+    return feeds;
+}
+
+void fill_feeds(std::vector<std::unique_ptr<hpc::core::spsc_ring_buffer<feed_tick>>>& feeds)
+{
+    for (std::size_t i = 0; i < merge_per_feed; ++i) {
+        for (std::size_t f = 0; f < feeds.size(); ++f) {
+            feeds[f]->try_push({i * feeds.size() + f, i});
+        }
+    }
+}
+
+// range(0) feeds merged in place through the tournament tree.
+void BM_FeedMerge_TournamentTree(benchmark::State& state)
+{
+    auto feeds = make_feeds(static_cast<std::size_t>(state.range(0)));
+    std::vector<hpc::core::spsc_ring_buffer<feed_tick>*> rings;
+    for (auto& f : feeds) {
+        rings.push_back(f.get());
+    }
+    hpc::core::spsc_merge_consumer<feed_tick, feed_tick_time> merge(rings, 0);
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        fill_feeds(feeds);
+        state.ResumeTiming();
+        merge.drain([&sum](std::size_t, feed_tick& t) { sum += t.payload; });
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(merge_per_feed));
+}
+
+// Baseline: copy every element into a binary heap, then pop in order.
+void BM_FeedMerge_CopyToHeap(benchmark::State& state)
+{
+    auto feeds = make_feeds(static_cast<std::size_t>(state.range(0)));
+    const auto later = [](const feed_tick& a, const feed_tick& b) { return a.ts > b.ts; };
+    std::priority_queue<feed_tick, std::vector<feed_tick>, decltype(later)> heap(later);
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        fill_feeds(feeds);
+        state.ResumeTiming();
+        for (auto& f : feeds) {
+            f->drain([&heap](feed_tick& t) { heap.push(t); });
+        }
+        while (!heap.empty()) {
+            sum += heap.top().payload;
+            heap.pop();
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(merge_per_feed));
+}
+
+// Cross-thread SPSC handoff whose head and tail indices are Pad bytes apart,
+// the pair starting on a 128-byte boundary. At Pad = 64 they are adjacent
+// lines of one spatial-prefetcher pair; at 128 they are fully independent.
+// The library's rings use hpc::support::destructive_interference_size.
+template <std::size_t Pad>
+struct index_pair_ring {
+    static constexpr std::size_t capacity = 1024;
+
+    alignas(128) std::atomic<std::size_t> head{0};
+    std::byte gap[Pad - sizeof(std::atomic<std::size_t>)]{};
+    std::atomic<std::size_t> tail{0};
+    alignas(128) std::uint64_t slots[capacity]{};
+};
+
+constexpr std::size_t handoff_batch = 256;
+
+// Two threads: thread 0 produces, thread 1 consumes handoff_batch items per
+// iteration. Both run the same iteration count, so the ring drains each run.
+template <std::size_t Pad>
+void BM_SPSCHandoff_IndexPadding(benchmark::State& state)
+{
+    static index_pair_ring<Pad> ring;
+    const bool producer = state.thread_index() == 0;
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        for (std::size_t n = 0; n < handoff_batch; ++n) {
+            std::size_t spins = 0;
+            if (producer) {
+                const std::size_t tail = ring.tail.load(std::memory_order_relaxed);
+                while (tail - ring.head.load(std::memory_order_acquire) == ring.capacity) {
+                    if (++spins % 1024 == 0) std::this_thread::yield();
+                }
+                ring.slots[tail & (ring.capacity - 1)] = tail;
+                ring.tail.store(tail + 1, std::memory_order_release);
+            } else {
+                const std::size_t head = ring.head.load(std::memory_order_relaxed);
+                while (ring.tail.load(std::memory_order_acquire) == head) {
+                    if (++spins % 1024 == 0) std::this_thread::yield();
+                }
+                sum += ring.slots[head & (ring.capacity - 1)];
+                ring.head.store(head + 1, std::memory_order_release);
+            }
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(handoff_batch));
+    if (producer) {
+        state.counters["line_bytes"] = static_cast<double>(hpc::support::runtime_cache_line_size());
+        state.counters["build_padding"] = static_cast<double>(hpc::support::destructive_interference_size);
+    }
+}
+
 } // namespace
 
 BENCHMARK(BM_SPSCQueue_Throughput)->Arg(1 << 10);
+BENCHMARK(BM_SPSCUnboundedQueue_Throughput)->Arg(1 << 10);
 BENCHMARK(BM_StdQueue_Throughput)->Arg(1 << 10);
 
+BENCHMARK_TEMPLATE(BM_SPSCQueue_DrainBacklog, 64)->Arg(0)->Arg(4)->Arg(16);
+BENCHMARK_TEMPLATE(BM_SPSCQueue_DrainBacklog, 256)->Arg(0)->Arg(4)->Arg(16);
+BENCHMARK_TEMPLATE(BM_SPSCQueue_DrainBacklog, 1024)->Arg(0)->Arg(2)->Arg(8);
+BENCHMARK_TEMPLATE(BM_SPSCQueue_DrainBacklog, 4096)->Arg(0)->Arg(1)->Arg(4);
+
+BENCHMARK_TEMPLATE(BM_SPSCQueue_FillBacklog, 64)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SPSCQueue_FillBacklog, 256)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SPSCQueue_FillBacklog, 1024)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_SPSCQueue_FillBacklog, 4096)->Arg(0)->Arg(1);
+
+BENCHMARK(BM_RingSweep_ProbeAll)->Arg(1)->Arg(16)->Arg(256);
+BENCHMARK(BM_RingSweep_ActivityBitmap)->Arg(1)->Arg(16)->Arg(256);
+
+BENCHMARK(BM_FeedMerge_TournamentTree)->Arg(2)->Arg(8)->Arg(32);
+BENCHMARK(BM_FeedMerge_CopyToHeap)->Arg(2)->Arg(8)->Arg(32);
+
+BENCHMARK_TEMPLATE(BM_SPSCHandoff_IndexPadding, 64)->Threads(2)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SPSCHandoff_IndexPadding, 128)->Threads(2)->UseRealTime();
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <hpc/core/backoff.hpp>
 #include <hpc/core/ttas_spinlock.hpp>
 
 #include <mutex>
@@ -64,8 +65,32 @@ void BM_StdMutex_Contention(benchmark::State& state)
     }
 }
 
+// Wall time of one calibrated spin of range(0) ns; should track the argument
+// on any CPU generation, unlike a fixed pause count.
+void BM_SpinForNs(benchmark::State& state)
+{
+    const auto ns = static_cast<std::uint64_t>(state.range(0));
+    for (auto _ : state) {
+        hpc::core::spin_for_ns(ns);
+    }
+    state.counters["pause_ns"] = hpc::core::pause_cost_ns();
+}
+
+// Baseline: the fixed iteration count whose duration the above replaces.
+void BM_PauseLoop_Fixed(benchmark::State& state)
+{
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    for (auto _ : state) {
+        for (std::uint64_t i = 0; i < n; ++i) {
+            hpc::core::cpu_relax();
+        }
+    }
+}
+
 } // namespace
 
 BENCHMARK(BM_TTAS_Spinlock_Contention);
 BENCHMARK(BM_StdMutex_Contention);
+BENCHMARK(BM_SpinForNs)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_PauseLoop_Fixed)->Arg(16)->Arg(1024);
 
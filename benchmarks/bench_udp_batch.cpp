@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstring>
+
+#include <unistd.h>
+
+#include <hpc/io/udp_batch.hpp>
+
+namespace {
+
+// Loopback ingest: 64-byte datagrams sent from one ring and received into
+// another on the same thread; range(0) is the recvmmsg/sendmmsg batch size
+// (1 approximates a syscall per packet).
+void BM_UdpLoopback_Batch(benchmark::State& state)
+{
+    using datagram = hpc::io::udp_datagram<256>;
+    const auto batch = static_cast<std::size_t>(state.range(0));
+
+    const int rx = hpc::io::open_udp_socket("127.0.0.1", 0, 4 << 20);
+    const int tx = hpc::io::open_udp_socket("127.0.0.1", 0);
+    hpc::io::connect_udp_socket(tx, "127.0.0.1", hpc::io::local_port(rx));
+
+    hpc::core::spsc_ring_buffer<datagram> outbound(1023);
+    hpc::core::spsc_ring_buffer<datagram> inbound(1023);
+    hpc::io::udp_sender<datagram> sender(tx, outbound, batch);
+    hpc::io::udp_receiver<datagram> receiver(rx, inbound, batch);
+
+    std::size_t received = 0;
+    for (auto _ : state) {
+        // Queue one batch worth of messages, send, then receive them.
+        for (std::size_t i = 0; i < batch; ++i) {
+            datagram* d = outbound.try_acquire_producer_slot();
+            d->peer_length = 0;
+            d->length = 64;
+            std::memset(d->payload, 0x5a, 64);
+            outbound.commit_producer_slot();
+        }
+        while (!outbound.empty()) {
+            sender.flush();
+        }
+        std::size_t got = 0;
+        while (got < batch) {
+            got += receiver.poll();
+        }
+        received += got;
+        inbound.release_consumer_slots(got);
+    }
+
+    ::close(tx);
+    ::close(rx);
+    state.SetItemsProcessed(static_cast<std::int64_t>(received));
+}
+
+} // namespace
+
+BENCHMARK(BM_UdpLoopback_Batch)->Arg(1)->Arg(8)->Arg(64);
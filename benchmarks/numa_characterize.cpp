@@ -0,0 +1,191 @@
+// Measure memory latency and bandwidth between every pair of NUMA nodes and
+// write the matrix as JSON (see hpc/support/numa_characterization.hpp).
+//
+// For each CPU node i and memory node j a thread pinned to a core of node i
+// reads a numa_arena bound to node j:
+//  - latency: a dependent pointer chase over a random cyclic permutation of
+//    cache lines, so every load misses and cannot be prefetched; reported in
+//    ns per load.
+//  - bandwidth: a sequential sum over the same buffer; the best of a few
+//    passes in GB/s (single thread, so a per-core rather than socket figure).
+// The buffer should be well above the last-level cache size.
+//
+// Usage: hpc_numa_characterize [--size-mib N] [--output FILE]
+
+#include <hpc/core/numa_arena.hpp>
+#include <hpc/support/cache_line.hpp>
+#include <hpc/support/clock.hpp>
+#include <hpc/support/cpu_topology.hpp>
+#include <hpc/support/numa_characterization.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct alignas(hpc::support::cache_line_size) chase_line {
+    chase_line* next;
+};
+
+struct pair_result {
+    double latency_ns = 0.0;
+    double bandwidth_gbps = 0.0;
+};
+
+// Link the lines into one random cycle (Sattolo's algorithm).
+chase_line* build_chase(void* memory, std::size_t lines)
+{
+    auto* base = static_cast<chase_line*>(memory);
+    std::vector<std::size_t> order(lines);
+    for (std::size_t i = 0; i < lines; ++i) {
+        order[i] = i;
+    }
+    std::mt19937_64 rng(42);
+    for (std::size_t i = lines - 1; i > 0; --i) {
+        std::uniform_int_distribution<std::size_t> pick(0, i - 1);
+        std::swap(order[i], order[pick(rng)]);
+    }
+    for (std::size_t i = 0; i < lines; ++i) {
+        base[order[i]].next = &base[order[(i + 1) % lines]];
+    }
+    return &base[order[0]];
+}
+
+double chase_ns(chase_line* start, std::size_t loads)
+{
+    chase_line* p = start;
+    const auto t0 = hpc::support::clock::now();
+    for (std::size_t i = 0; i < loads; ++i) {
+        p = p->next;
+    }
+    const auto t1 = hpc::support::clock::now();
+    // Keep the chain live.
+    if (p == nullptr) {
+        std::abort();
+    }
+    return static_cast<double>(hpc::support::to_nanoseconds(t1 - t0)) / static_cast<double>(loads);
+}
+
+double stream_gbps(const void* memory, std::size_t bytes)
+{
+    const auto* words = static_cast<const std::uint64_t*>(memory);
+    const std::size_t n = bytes / sizeof(std::uint64_t);
+    double best = 0.0;
+    for (int pass = 0; pass < 3; ++pass) {
+        std::uint64_t sum = 0;
+        const auto t0 = hpc::support::clock::now();
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += words[i];
+        }
+        const auto t1 = hpc::support::clock::now();
+        // volatile sink: the sum must be computed.
+        static volatile std::uint64_t sink;
+        sink = sum;
+        const auto ns = static_cast<double>(hpc::support::to_nanoseconds(t1 - t0));
+        if (ns > 0.0 && static_cast<double>(bytes) / ns > best) {
+            best = static_cast<double>(bytes) / ns;
+        }
+    }
+    return best;
+}
+
+pair_result measure(int cpu_node, int mem_node, std::size_t bytes)
+{
+    pair_result result;
+    hpc::core::numa_arena memory(bytes, mem_node);
+    void* buffer = memory.allocate(bytes, hpc::support::cache_line_size);
+    if (!buffer) {
+        return result;
+    }
+
+    // Start the worker parked so it is pinned before it touches anything.
+    std::atomic<bool> go{false};
+    std::thread worker([&] {
+        while (!go.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        const std::size_t lines = bytes / sizeof(chase_line);
+        chase_line* start = build_chase(buffer, lines);
+        chase_ns(start, lines); // warm the TLB and page tables
+        result.latency_ns = chase_ns(start, lines);
+        result.bandwidth_gbps = stream_gbps(buffer, lines * sizeof(chase_line));
+    });
+    const std::vector<unsigned> cores = hpc::support::cores_of_node(cpu_node);
+    if (!cores.empty() && !hpc::support::pin_thread_to_core(worker, cores.front())) {
+        std::fprintf(stderr, "warning: could not pin to core %u of node %d\n", cores.front(), cpu_node);
+    }
+    go.store(true, std::memory_order_release);
+    worker.join();
+
+    if (memory.node() != mem_node) {
+        std::fprintf(stderr, "warning: memory for node %d is not bound (no libnuma?)\n", mem_node);
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t size_mib = 256;
+    std::string output;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--size-mib") == 0 && i + 1 < argc) {
+            size_mib = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else {
+            std::fprintf(stderr, "usage: %s [--size-mib N] [--output FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (size_mib == 0) {
+        std::fprintf(stderr, "--size-mib must be positive\n");
+        return 2;
+    }
+    const std::size_t bytes = size_mib << 20;
+
+    hpc::support::numa_characterization result = hpc::support::numa_characterization_from_topology();
+    const auto n = static_cast<std::size_t>(result.nodes);
+    result.latency_ns.assign(n, std::vector<double>(n, 0.0));
+    result.bandwidth_gbps.assign(n, std::vector<double>(n, 0.0));
+
+    for (int cpu = 0; cpu < result.nodes; ++cpu) {
+        if (hpc::support::cores_of_node(cpu).empty()) {
+            std::fprintf(stderr, "node %d has no CPUs; skipping its row\n", cpu);
+            continue;
+        }
+        for (int mem = 0; mem < result.nodes; ++mem) {
+            if (result.distance[static_cast<std::size_t>(cpu)][static_cast<std::size_t>(mem)] < 0) {
+                continue; // node id not online
+            }
+            const pair_result r = measure(cpu, mem, bytes);
+            result.latency_ns[static_cast<std::size_t>(cpu)][static_cast<std::size_t>(mem)] = r.latency_ns;
+            result.bandwidth_gbps[static_cast<std::size_t>(cpu)][static_cast<std::size_t>(mem)] = r.bandwidth_gbps;
+            std::fprintf(stderr, "cpu node %d -> mem node %d: %.1f ns/load, %.2f GB/s\n",
+                         cpu, mem, r.latency_ns, r.bandwidth_gbps);
+        }
+    }
+
+    try {
+        if (output.empty()) {
+            std::fputs(hpc::support::to_json(result).c_str(), stdout);
+        } else {
+            hpc::support::save_numa_characterization(result, output);
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,35 @@
+# Schema.cmake - generate fixed-layout message structs from JSON schemas
+#
+# hpc_generate_schema(<target> <schema.json>) runs tools/hpc_schema_gen.py at
+# build time and produces
+#   ${CMAKE_BINARY_DIR}/generated/include/hpc_schema/<name>.hpp  (C++ structs)
+#   ${CMAKE_BINARY_DIR}/generated/python/<name>.py               (NumPy dtypes)
+# The C++ header is added to <target>, whose include path gains
+# ${CMAKE_BINARY_DIR}/generated/include.
+
+find_package(Python3 COMPONENTS Interpreter)
+
+set(HPC_SCHEMA_GENERATOR ${CMAKE_CURRENT_LIST_DIR}/../tools/hpc_schema_gen.py)
+
+function(hpc_generate_schema target schema)
+    if(NOT Python3_Interpreter_FOUND)
+        message(FATAL_ERROR "hpc_generate_schema(${target}) requires a Python 3 interpreter")
+    endif()
+
+    get_filename_component(schema_abs ${schema} ABSOLUTE)
+    get_filename_component(name ${schema} NAME_WE)
+    set(out_dir ${CMAKE_BINARY_DIR}/generated)
+    set(hpp ${out_dir}/include/hpc_schema/${name}.hpp)
+    set(py ${out_dir}/python/${name}.py)
+
+    add_custom_command(
+        OUTPUT ${hpp} ${py}
+        COMMAND ${Python3_EXECUTABLE} ${HPC_SCHEMA_GENERATOR} ${schema_abs} --cpp ${hpp} --python ${py}
+        DEPENDS ${schema_abs} ${HPC_SCHEMA_GENERATOR}
+        COMMENT "Generating message layouts from ${name}.json"
+        VERBATIM
+    )
+
+    target_sources(${target} PRIVATE ${hpp})
+    target_include_directories(${target} PRIVATE ${out_dir}/include)
+endfunction()
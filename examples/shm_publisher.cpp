@@ -1,5 +1,6 @@
 #include <chrono>
 #include <csignal>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <exception>
@@ -7,16 +8,23 @@
 #include <thread>
 
 #include <hpc/ipc/shm_ring_buffer.hpp>
+#include <hpc_schema/shm_messages.hpp> // generated from shm_messages.json
 
 namespace {
 
 using clock = std::chrono::steady_clock;
 
-struct Message {
-    std::uint64_t seq;
-    std::uint64_t timestamp_ns;
-    std::uint8_t  payload[48];
-};
+// Message and ShmSpscHeader come from examples/shm_messages.json, which also
+// generates the NumPy dtypes used by shm_subscriber.py.
+using hpc::examples::Message;
+using hpc::examples::ShmSpscHeader;
+
+// The ring header is owned by the library; make sure the schema mirror the
+// Python side reads still matches it.
+static_assert(sizeof(ShmSpscHeader) == sizeof(hpc::ipc::shm_spsc_header));
+static_assert(offsetof(ShmSpscHeader, capacity) == offsetof(hpc::ipc::shm_spsc_header, capacity));
+static_assert(offsetof(ShmSpscHeader, head) == offsetof(hpc::ipc::shm_spsc_header, head));
+static_assert(offsetof(ShmSpscHeader, tail) == offsetof(hpc::ipc::shm_spsc_header, tail));
 
 constexpr const char* kShmName   = "/hpc_shm_spsc_ring";
 constexpr std::size_t kCapacity  = 1024; // number of messages
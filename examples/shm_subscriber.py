@@ -1,21 +1,21 @@
 #!/usr/bin/env python3
 import mmap
+import os
 import signal
-import struct
 import sys
 import time
 
+import numpy as np
 import posix_ipc  # pip install posix_ipc
 
-SHM_NAME = "/hpc_shm_spsc_ring"
-
-# Keep in sync with the C++ Message struct
-MESSAGE_STRUCT = struct.Struct("<QQ48s")  # seq (u64), ts (u64), payload[48]
-MESSAGE_SIZE = MESSAGE_STRUCT.size
+# Generated from examples/shm_messages.json by the build
+# (build/generated/python/shm_messages.py); override with HPC_GENERATED_PY.
+sys.path.insert(0, os.environ.get(
+    "HPC_GENERATED_PY",
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "build", "generated", "python")))
+from shm_messages import MESSAGE_DTYPE, SHM_SPSC_HEADER_DTYPE, SHM_SPSC_HEADER_SIZE  # noqa: E402
 
-# Header layout: capacity (u64), head (u64), tail (u64)
-HEADER_STRUCT = struct.Struct("<QQQ")
-HEADER_SIZE = HEADER_STRUCT.size
+SHM_NAME = "/hpc_shm_spsc_ring"
 
 stop = False
 
@@ -37,44 +37,43 @@ def main() -> int:
         return 1
 
     # First, map just the header to read capacity.
-    mm_header = mmap.mmap(shm.fd, HEADER_SIZE, access=mmap.ACCESS_READ)
-    raw_header = mm_header[:HEADER_SIZE]
-    capacity, head_idx, tail_idx = HEADER_STRUCT.unpack(raw_header)
+    mm_header = mmap.mmap(shm.fd, SHM_SPSC_HEADER_SIZE, access=mmap.ACCESS_READ)
+    capacity = int(np.frombuffer(mm_header, dtype=SHM_SPSC_HEADER_DTYPE, count=1)[0]["capacity"])
     mm_header.close()
 
-    total_size = HEADER_SIZE + capacity * MESSAGE_SIZE
+    total_size = SHM_SPSC_HEADER_SIZE + capacity * MESSAGE_DTYPE.itemsize
 
     # Remap the full region now that we know the capacity/size.
     mm = mmap.mmap(shm.fd, total_size, access=mmap.ACCESS_READ)
     shm.close_fd()
 
+    # Zero-copy views over the ring: no per-message decoding.
+    header = np.frombuffer(mm, dtype=SHM_SPSC_HEADER_DTYPE, count=1)
+    slots = np.frombuffer(mm, dtype=MESSAGE_DTYPE, count=capacity, offset=SHM_SPSC_HEADER_SIZE)
+
     max_messages = 20
     count = 0
+    msg = None
 
     try:
         while not stop and count < max_messages:
-            # Reload header each iteration to see updated head/tail.
-            raw_header = mm[0:HEADER_SIZE]
-            capacity, head_idx, tail_idx = HEADER_STRUCT.unpack(raw_header)
+            # Reload indices each iteration to see updated head/tail.
+            head_idx = int(header[0]["head"])
+            tail_idx = int(header[0]["tail"])
 
             if head_idx == tail_idx:
                 # Queue is empty; sleep briefly and retry.
                 time.sleep(0.001)
                 continue
 
-            idx = head_idx % capacity
-            offset = HEADER_SIZE + idx * MESSAGE_SIZE
-            raw = mm[offset : offset + MESSAGE_SIZE]
-            if len(raw) != MESSAGE_SIZE:
-                time.sleep(0.001)
-                continue
-
-            seq, ts_ns, payload = MESSAGE_STRUCT.unpack(raw)
-
-            print(f"seq={seq} ts={ts_ns} payload[0:4]={payload[:4].hex()} (head={head_idx} tail={tail_idx})")
+            msg = slots[head_idx % capacity]
+            print(f"seq={msg['seq']} ts={msg['timestamp_ns']} payload[0:4]={msg['payload'][:4].tobytes().hex()} "
+                  f"(head={head_idx} tail={tail_idx})")
             count += 1
             time.sleep(0.01)
     finally:
+        # Views must be released before the mapping can be closed.
+        del header, slots, msg
         mm.close()
 
     return 0
@@ -82,4 +81,3 @@ def main() -> int:
 
 if __name__ == "__main__":
     sys.exit(main())
-
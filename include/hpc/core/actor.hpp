@@ -0,0 +1,222 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <hpc/core/arena_allocator.hpp>
+#include <hpc/core/numa_ring_buffer.hpp>
+#include <hpc/support/cache_line.hpp>
+#include <hpc/support/noncopyable.hpp>
+
+namespace hpc::core {
+
+// Lightweight actor runtime: many message-driven components multiplexed onto
+// a few pinned scheduler threads.
+//
+// Design notes:
+//  - Each actor owns a bounded mailbox (a numa_mpmc_ring_buffer used as MPSC:
+//    any thread sends, only the worker running the actor receives). Its
+//    cells are carved from a numa_arena on the scheduler's node, messages
+//    are stored inline, and actors themselves are placement-constructed in
+//    the scheduler's arena, so steady-state messaging never allocates.
+//  - An actor is on the shared run queue at most once: send() enqueues it
+//    only when it flips the actor's `scheduled` flag from false to true. The
+//    run queue therefore never holds more than max_actors entries.
+//  - A worker drains at most `budget` messages per activation. If the budget
+//    was used up the actor goes to the back of the run queue; otherwise the
+//    worker clears the flag, fences, and re-checks the mailbox, mirroring the
+//    sender's push-fence-check, so a message racing with the hand-off is
+//    never stranded.
+//  - Only one worker runs a given actor at a time; the flag hand-off
+//    (release store, acq_rel exchange) and the run queue carry the
+//    happens-before edge, so actor state needs no locking.
+//  - Idle workers back off exponentially (exponential_backoff), then yield;
+//    they never block in the kernel.
+
+class actor_scheduler;
+
+class actor : private hpc::support::noncopyable {
+public:
+    virtual ~actor() = default;
+
+    actor_scheduler& scheduler() const noexcept { return *scheduler_; }
+
+protected:
+    explicit actor(actor_scheduler& scheduler) noexcept : scheduler_(&scheduler) {}
+
+    // Call after publishing a message to the mailbox.
+    void schedule() noexcept;
+
+private:
+    friend class actor_scheduler;
+
+    // Process up to `budget` messages; return how many were processed.
+    virtual std::size_t run(std::size_t budget) = 0;
+    virtual bool has_messages() const noexcept = 0;
+
+    actor_scheduler* scheduler_;
+    std::atomic<bool> scheduled_{false};
+};
+
+// Actor receiving messages of type Msg. Derived classes implement
+// on_message() and take the scheduler as their first constructor argument.
+// on_message() is noexcept: it runs on a scheduler worker, which has no one
+// to report an exception to, so an actor must handle its own failures.
+template <class Msg>
+class basic_actor : public actor {
+public:
+    // Any thread. Fails if the mailbox is full.
+    bool send(const Msg& message)
+    {
+        if (!mailbox_.try_push(message)) {
+            return false;
+        }
+        schedule();
+        return true;
+    }
+
+    bool send(Msg&& message)
+    {
+        if (!mailbox_.try_push(std::move(message))) {
+            return false;
+        }
+        schedule();
+        return true;
+    }
+
+    std::size_t mailbox_capacity() const noexcept { return mailbox_.capacity(); }
+
+protected:
+    basic_actor(actor_scheduler& scheduler, std::size_t mailbox_capacity);
+
+    ~basic_actor() override
+    {
+        // Destroy messages that were never delivered.
+        mailbox_.drain([](Msg&) noexcept {});
+    }
+
+    virtual void on_message(Msg& message) noexcept = 0;
+
+private:
+    std::size_t run(std::size_t budget) override
+    {
+        return mailbox_.drain([this](Msg& m) noexcept { on_message(m); }, budget);
+    }
+
+    bool has_messages() const noexcept override { return !mailbox_.empty(); }
+
+    numa_mpmc_ring_buffer<Msg> mailbox_;
+};
+
+struct actor_scheduler_config {
+    std::size_t worker_count = 1;       // scheduler threads
+    std::vector<unsigned> cores{};      // worker i is pinned to cores[i % size]; empty = unpinned
+    std::size_t budget = 64;            // messages per activation
+    std::size_t max_actors = 1024;      // bounds spawn() and the run queue
+    std::size_t arena_bytes = 1u << 20; // storage for actor objects
+    int numa_node = -1;                 // placement of mailbox cells; -1 = unbound
+};
+
+class actor_scheduler : private hpc::support::noncopyable {
+public:
+    explicit actor_scheduler(const actor_scheduler_config& cfg);
+
+    // Stops the workers, then destroys all actors in reverse spawn order.
+    ~actor_scheduler();
+
+    actor_scheduler(actor_scheduler&&) = delete;
+    actor_scheduler& operator=(actor_scheduler&&) = delete;
+
+    // Construct an A(*this, args...) in the scheduler's arena. Not
+    // thread-safe with other spawn() calls. Throws std::bad_alloc when the
+    // arena or max_actors is exhausted.
+    template <class A, class... Args>
+    A& spawn(Args&&... args)
+    {
+        if (actors_.size() == max_actors_) {
+            throw std::bad_alloc();
+        }
+        void* storage = arena_.allocate(sizeof(A), alignof(A));
+        if (!storage) {
+            throw std::bad_alloc();
+        }
+        A* a = ::new (storage) A(*this, std::forward<Args>(args)...);
+        actors_.push_back(a);
+        return *a;
+    }
+
+    // Launch the worker threads. Actors may be spawned and sent to before
+    // this; their messages wait in the mailboxes.
+    void start();
+
+    // Ask the workers to exit and join them. Undelivered messages stay in
+    // the mailboxes.
+    void stop();
+
+    std::size_t budget() const noexcept { return budget_; }
+    int numa_node() const noexcept { return numa_node_; }
+    std::size_t worker_count() const noexcept { return worker_count_; }
+
+    // Totals across workers (approximate while running).
+    std::uint64_t activations() const noexcept;
+    std::uint64_t messages_processed() const noexcept;
+
+private:
+    friend class actor;
+
+    struct alignas(hpc::support::destructive_interference_size) worker_stats {
+        std::atomic<std::uint64_t> activations{0};
+        std::atomic<std::uint64_t> messages{0};
+    };
+
+    // Cannot fail: an actor is queued at most once and the run queue holds
+    // at least max_actors entries (see run_queue_).
+    void enqueue(actor* a) noexcept
+    {
+        [[maybe_unused]] const bool queued = run_queue_.try_push(a);
+        assert(queued && "run queue must hold every actor at once");
+    }
+    void worker_loop(std::size_t index) noexcept;
+
+    std::size_t worker_count_;
+    std::vector<unsigned> cores_;
+    std::size_t budget_;
+    std::size_t max_actors_;
+    int numa_node_;
+
+    arena arena_;
+    std::vector<actor*> actors_;
+    // Sized for max_actors (rounded up to a power of two), so every spawned
+    // actor fits at once and enqueue() never sees a full queue.
+    mpmc_ring_buffer<actor*> run_queue_;
+    std::unique_ptr<worker_stats[]> stats_;
+    std::vector<std::thread> threads_;
+    std::atomic<bool> running_{false};
+};
+
+inline void actor::schedule() noexcept
+{
+    // Order the mailbox push before reading the flag; pairs with the fence
+    // in actor_scheduler::worker_loop().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!scheduled_.load(std::memory_order_relaxed)
+        && !scheduled_.exchange(true, std::memory_order_acq_rel)) {
+        scheduler_->enqueue(this);
+    }
+}
+
+template <class Msg>
+basic_actor<Msg>::basic_actor(actor_scheduler& scheduler, std::size_t mailbox_capacity)
+    : actor(scheduler)
+    , mailbox_(mailbox_capacity, scheduler.numa_node())
+{
+}
+
+} // namespace hpc::core
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define HPC_HAS_MM_PAUSE 1
+#else
+#define HPC_HAS_MM_PAUSE 0
+#endif
+
+namespace hpc::core {
+
+// Spin-wait backoff policies specified in nanoseconds.
+//
+// Design notes:
+//  - The latency of one pause instruction ranges from ~10 cycles (older
+//    Intel, most AMD) to ~140 cycles (Skylake-SP and later), so a backoff
+//    counted in pause iterations is an order of magnitude off on one of them.
+//    pause_cost_ns() times cpu_relax() once at startup (best of several
+//    rounds) and the policies convert their delays to iterations with it.
+//  - exponential_backoff doubles its delay up to a cap and then reports that
+//    the spin budget is spent, so the caller can yield or block: for waits
+//    whose length is unknown (idle workers, full queues).
+//  - proportional_backoff waits in proportion to a known distance, e.g. how
+//    many slots or tickets are ahead of the caller, up to a total budget.
+//  - randomized_backoff draws each delay uniformly from a doubling window so
+//    that waiters released together do not retry together (lock handoff).
+//    It never gives up; use it where the owner is known to be running.
+//  - The policies are small value types meant to live on the waiter's stack;
+//    construct one per wait.
+
+// One spin-wait hint: PAUSE on x86 (GCC/Clang and MSVC), YIELD on arm64
+// with GCC/Clang, otherwise only a compiler barrier so the spin loop still
+// re-reads memory.
+inline void cpu_relax() noexcept
+{
+#if HPC_HAS_MM_PAUSE
+    _mm_pause();
+#elif (defined(__aarch64__) || defined(__arm__)) && (defined(__GNUC__) || defined(__clang__))
+    __asm__ __volatile__("yield" ::: "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// Calibrated cost of one cpu_relax() in nanoseconds (never zero).
+double pause_cost_ns() noexcept;
+
+// Spin with cpu_relax() for about `ns` nanoseconds.
+void spin_for_ns(std::uint64_t ns) noexcept;
+
+class exponential_backoff {
+public:
+    explicit exponential_backoff(std::uint32_t min_ns = 32, std::uint32_t max_ns = 16384) noexcept
+        : delay_ns_(min_ns == 0 ? 1 : min_ns)
+        , min_ns_(delay_ns_)
+        , max_ns_(max_ns < delay_ns_ ? delay_ns_ : max_ns)
+    {
+    }
+
+    // Spin for the current delay and double it. Returns false, without
+    // spinning, once a full max_ns delay has already been spent.
+    bool pause() noexcept
+    {
+        if (spent_) {
+            return false;
+        }
+        spin_for_ns(delay_ns_);
+        if (delay_ns_ == max_ns_) {
+            spent_ = true;
+        }
+        delay_ns_ = delay_ns_ > max_ns_ / 2 ? max_ns_ : delay_ns_ * 2;
+        return true;
+    }
+
+    void reset() noexcept
+    {
+        delay_ns_ = min_ns_;
+        spent_ = false;
+    }
+
+private:
+    std::uint32_t delay_ns_;
+    std::uint32_t min_ns_;
+    std::uint32_t max_ns_;
+    bool spent_ = false;
+};
+
+class proportional_backoff {
+public:
+    // Waits ns_per_unit per unit of distance, at most max_ns per pause and
+    // budget_ns in total.
+    explicit proportional_backoff(std::uint32_t ns_per_unit, std::uint32_t max_ns = 4096,
+                                  std::uint32_t budget_ns = 32768) noexcept
+        : ns_per_unit_(ns_per_unit == 0 ? 1 : ns_per_unit)
+        , max_ns_(max_ns)
+        , budget_ns_(budget_ns)
+    {
+    }
+
+    // Spin for distance * ns_per_unit (capped). Returns false, without
+    // spinning, once the total budget has been spent.
+    bool pause(std::uint64_t distance) noexcept
+    {
+        if (spent_ns_ >= budget_ns_) {
+            return false;
+        }
+        const std::uint64_t units = distance == 0 ? 1 : distance;
+        const std::uint64_t ns = units > max_ns_ / ns_per_unit_ ? max_ns_ : units * ns_per_unit_;
+        spin_for_ns(ns);
+        spent_ns_ += ns;
+        return true;
+    }
+
+    void reset() noexcept { spent_ns_ = 0; }
+
+private:
+    std::uint64_t ns_per_unit_;
+    std::uint64_t max_ns_;
+    std::uint64_t budget_ns_;
+    std::uint64_t spent_ns_ = 0;
+};
+
+class randomized_backoff {
+public:
+    explicit randomized_backoff(std::uint32_t min_ns = 32, std::uint32_t max_ns = 8192) noexcept
+        : window_ns_(min_ns == 0 ? 1 : min_ns)
+        , min_ns_(window_ns_)
+        , max_ns_(max_ns < window_ns_ ? window_ns_ : max_ns)
+    {
+    }
+
+    // Spin for a uniform random delay in [min_ns, window], then double the
+    // window up to max_ns.
+    void pause() noexcept
+    {
+        if (state_ == 0) {
+            state_ = seed();
+        }
+        // xorshift64
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 7;
+        state_ ^= state_ << 17;
+        spin_for_ns(min_ns_ + state_ % (window_ns_ - min_ns_ + 1));
+        window_ns_ = window_ns_ > max_ns_ / 2 ? max_ns_ : window_ns_ * 2;
+    }
+
+    void reset() noexcept { window_ns_ = min_ns_; }
+
+private:
+    // Distinct per thread and per wait; never zero.
+    static std::uint64_t seed() noexcept;
+
+    std::uint64_t state_ = 0;
+    std::uint32_t window_ns_;
+    std::uint32_t min_ns_;
+    std::uint32_t max_ns_;
+};
+
+} // namespace hpc::core
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpc/support/huge_pages.hpp>
+#include <hpc/support/noncopyable.hpp>
+
+namespace hpc::core {
+
+namespace detail {
+
+// Bitmap with summary levels: bit i of level L+1 is set iff word i of level L
+// is non-zero, so find_first() is one countr_zero per level.
+class summary_bitmap {
+public:
+    summary_bitmap() = default;
+    explicit summary_bitmap(std::size_t bits);
+
+    void set(std::size_t i) noexcept;
+    void clear(std::size_t i) noexcept;
+    bool test(std::size_t i) const noexcept { return (levels_[0][i >> 6] >> (i & 63)) & 1u; }
+
+    // Lowest set bit, or npos.
+    std::size_t find_first() const noexcept;
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+private:
+    std::vector<std::vector<std::uint64_t>> levels_; // [0] = leaf bits
+};
+
+} // namespace detail
+
+// Binary buddy allocator for medium-to-large buffers inside one huge-page
+// region.
+//
+// Design notes:
+//  - The region is split into top-level blocks of max_block bytes (or the
+//    largest power of two that fits), each managed as a binary buddy tree
+//    down to min_block.
+//  - All metadata lives outside the managed memory: one summary_bitmap of
+//    free blocks per order plus one order byte per min_block. Free blocks are
+//    never written to, so untouched memory stays unfaulted and cache-cold.
+//  - allocate() finds the smallest order with a free block and splits it
+//    down; deallocate() merges with the buddy while the buddy is free. Both
+//    are O(orders * bitmap levels), i.e. O(log n).
+//  - Block addresses are aligned to min(block size, region alignment).
+//  - Not thread-safe; like arena and fixed_pool, one owner per instance.
+
+struct buddy_stats {
+    std::size_t capacity = 0;           // managed bytes
+    std::size_t free_bytes = 0;
+    std::size_t largest_free_block = 0;
+    std::size_t allocations = 0;        // live blocks
+    // 1 - largest_free_block / free_bytes: 0 when all free memory is one
+    // block, approaching 1 as it splinters.
+    double external_fragmentation = 0.0;
+    std::vector<std::size_t> free_blocks_per_order; // index 0 = min_block
+};
+
+class buddy_allocator : private hpc::support::noncopyable {
+public:
+    static constexpr std::size_t default_min_block = std::size_t{4} << 10;
+    static constexpr std::size_t default_max_block = std::size_t{64} << 20;
+
+    // Block sizes are rounded up to powers of two. capacity is rounded down
+    // to a whole number of top-level blocks. Throws std::bad_alloc if the
+    // region cannot be mapped and std::invalid_argument if it would be empty.
+    explicit buddy_allocator(std::size_t capacity,
+                             std::size_t min_block = default_min_block,
+                             std::size_t max_block = default_max_block);
+    ~buddy_allocator();
+
+    buddy_allocator(buddy_allocator&&) = delete;
+    buddy_allocator& operator=(buddy_allocator&&) = delete;
+
+    // Smallest block holding `bytes`, or nullptr if none is free (or bytes
+    // exceeds the top-level block size).
+    [[nodiscard]] void* allocate(std::size_t bytes) noexcept;
+
+    // p must come from allocate(); nullptr is ignored.
+    void deallocate(void* p) noexcept;
+
+    // Size of the block backing p.
+    std::size_t block_size(const void* p) const noexcept;
+
+    bool owns(const void* p) const noexcept
+    {
+        const auto* b = static_cast<const std::byte*>(p);
+        return b >= base_ && b < base_ + capacity_;
+    }
+
+    std::size_t capacity() const noexcept { return capacity_; }
+    std::size_t min_block() const noexcept { return std::size_t{1} << min_shift_; }
+    std::size_t max_block() const noexcept { return std::size_t{1} << (min_shift_ + top_order_); }
+    std::size_t free_bytes() const noexcept { return free_bytes_; }
+
+    buddy_stats stats() const;
+
+private:
+    static constexpr std::uint8_t free_marker = 0xff;
+
+    std::size_t order_for(std::size_t bytes) const noexcept;
+
+    hpc::support::huge_page_region region_{};
+    std::byte* base_{};
+    std::size_t capacity_{};
+    unsigned min_shift_{};
+    unsigned top_order_{};
+
+    std::vector<detail::summary_bitmap> free_;     // per order
+    std::vector<std::size_t> free_count_;          // per order
+    std::vector<std::uint8_t> block_order_;        // per min block: order of the allocated block starting there
+    std::size_t free_bytes_{};
+    std::size_t allocations_{};
+};
+
+} // namespace hpc::core
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include <hpc/core/numa_arena.hpp>
+#include <hpc/support/cache_line.hpp>
+#include <hpc/support/huge_pages.hpp>
+#include <hpc/support/noncopyable.hpp>
+
+namespace hpc::core {
+
+// Arena shared by many threads for scratch memory that dies together at the
+// end of a parallel phase.
+//
+// Design notes:
+//  - Each thread allocates through its own thread_cache, which bump-allocates
+//    inside a private chunk and takes a new chunk from the shared arena with
+//    one relaxed fetch_add. Requests larger than half a chunk are carved
+//    directly so they do not waste the rest of the chunk. Once no whole
+//    chunk fits, a thread takes the remaining tail of a segment instead.
+//  - reset() rewinds the arena and bumps an epoch; each thread_cache notices
+//    the new epoch on its next allocation and drops its stale chunk. It must
+//    be called while no thread is allocating (e.g. after the phase barrier).
+//  - With NUMA nodes given, capacity is split into one numa_arena-backed
+//    segment per node; a thread_cache carves from its node's segment first
+//    and falls back to the others when it is exhausted. Without nodes the
+//    arena is one huge-page region.
+//  - Allocation fails (nullptr) only when every segment is exhausted.
+
+class concurrent_arena : private hpc::support::noncopyable {
+public:
+    static constexpr std::size_t default_chunk_size = std::size_t{256} << 10;
+
+    // One huge-page region. Throws std::bad_alloc if it cannot be mapped.
+    explicit concurrent_arena(std::size_t capacity, std::size_t chunk_size = default_chunk_size);
+
+    // capacity split evenly into one segment per NUMA node. Nodes that cannot
+    // be bound still yield (unbound) memory.
+    concurrent_arena(std::size_t capacity, std::size_t chunk_size, std::span<const int> numa_nodes);
+
+    ~concurrent_arena();
+
+    concurrent_arena(concurrent_arena&&) = delete;
+    concurrent_arena& operator=(concurrent_arena&&) = delete;
+
+    // Per-thread allocation cursor; create one per thread and do not share.
+    class thread_cache {
+    public:
+        // numa_node selects the preferred segment (ignored without NUMA
+        // segments or if the node has none).
+        explicit thread_cache(concurrent_arena& arena, int numa_node = -1) noexcept;
+
+        [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) noexcept
+        {
+            const std::uint64_t epoch = arena_->epoch_.load(std::memory_order_relaxed);
+            if (epoch != epoch_) {
+                epoch_ = epoch;
+                cursor_ = 0;
+                end_ = 0;
+            }
+            // end_ == 0 means no chunk yet: even a zero-byte request must
+            // refill rather than return the null cursor.
+            const std::uintptr_t aligned = (cursor_ + alignment - 1) & ~(alignment - 1);
+            if (aligned + bytes <= end_ && aligned >= cursor_ && end_ != 0) {
+                cursor_ = aligned + bytes;
+                return reinterpret_cast<void*>(aligned);
+            }
+            return refill(bytes, alignment);
+        }
+
+    private:
+        void* refill(std::size_t bytes, std::size_t alignment) noexcept;
+
+        concurrent_arena* arena_;
+        std::size_t segment_{};
+        std::uintptr_t cursor_{};
+        std::uintptr_t end_{};
+        std::uint64_t epoch_{};
+    };
+
+    // Release everything. Threads must not allocate concurrently.
+    void reset() noexcept;
+
+    std::size_t capacity() const noexcept { return capacity_; }
+    std::size_t chunk_size() const noexcept { return chunk_size_; }
+
+    // Bytes handed out as chunks or direct carves (approximate while running).
+    std::size_t used() const noexcept;
+
+    std::size_t segment_count() const noexcept { return segment_count_; }
+
+    // NUMA node of a segment, or -1 if unbound.
+    int segment_node(std::size_t i) const noexcept { return segments_[i].node; }
+
+private:
+    // Each segment's bump offset is padded apart from its neighbours'.
+    struct alignas(hpc::support::destructive_interference_size) segment {
+        std::atomic<std::size_t> next{0};
+        std::byte* base{};
+        std::size_t size{};
+        int node{-1};
+        std::unique_ptr<numa_arena> numa{};
+    };
+
+    // Carve `bytes` from segment `first`, falling back to the others.
+    std::byte* carve(std::size_t first, std::size_t bytes) noexcept;
+
+    // Carve what is left of a segment, at least min_bytes and at most
+    // max_bytes, into `got`; for tails smaller than a chunk.
+    std::byte* carve_remainder(std::size_t first, std::size_t min_bytes, std::size_t max_bytes,
+                               std::size_t& got) noexcept;
+
+    std::size_t capacity_{};
+    std::size_t chunk_size_{};
+    hpc::support::huge_page_region region_{};
+    std::unique_ptr<segment[]> segments_;
+    std::size_t segment_count_{};
+
+    alignas(hpc::support::destructive_interference_size) std::atomic<std::uint64_t> epoch_{1};
+};
+
+} // namespace hpc::core
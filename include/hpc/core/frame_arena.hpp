@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpc/core/arena_allocator.hpp>
+#include <hpc/support/huge_pages.hpp>
+#include <hpc/support/noncopyable.hpp>
+
+namespace hpc::core {
+
+// N rotating arenas for per-tick allocation lifecycles.
+//
+// Design notes:
+//  - One huge-page region is split into `frames` equal slices, each managed
+//    by an hpc::core::arena over caller-supplied memory.
+//  - allocate() bumps in the current frame's arena. advance_frame() moves to
+//    the next slice and resets it in O(1), so memory allocated during tick t
+//    stays valid through tick t + frames - 1: with two frames, exactly one
+//    more tick (e.g. for diffing against the previous tick).
+//  - There is no free path and destructors are not run; create<T>() is
+//    therefore limited to trivially destructible types.
+//  - Single-threaded, like arena.
+
+class frame_arena : private hpc::support::noncopyable {
+public:
+    // Throws std::bad_alloc if the region cannot be mapped.
+    explicit frame_arena(std::size_t bytes_per_frame, std::size_t frames = 2);
+    ~frame_arena();
+
+    frame_arena(frame_arena&&) = delete;
+    frame_arena& operator=(frame_arena&&) = delete;
+
+    // nullptr if the current frame is full.
+    [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        return frames_[current_].allocate(bytes, alignment);
+    }
+
+    template <class T, class... Args>
+    [[nodiscard]] T* create(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "frame_arena never runs destructors");
+        void* p = allocate(sizeof(T), alignof(T));
+        return p ? ::new (p) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    // Start the next tick: recycle the oldest frame. O(1).
+    void advance_frame() noexcept
+    {
+        current_ = current_ + 1 == frames_.size() ? 0 : current_ + 1;
+        frames_[current_].reset();
+        ++tick_;
+    }
+
+    std::size_t frame_count() const noexcept { return frames_.size(); }
+    std::size_t bytes_per_frame() const noexcept { return bytes_per_frame_; }
+
+    // Ticks elapsed, i.e. advance_frame() calls so far.
+    std::uint64_t tick() const noexcept { return tick_; }
+
+    // Bytes used in the current frame.
+    std::size_t used() const noexcept { return frames_[current_].used(); }
+
+private:
+    std::size_t bytes_per_frame_{};
+    hpc::support::huge_page_region region_{};
+    std::vector<arena> frames_;
+    std::size_t current_{};
+    std::uint64_t tick_{};
+};
+
+} // namespace hpc::core
@@ -6,7 +6,9 @@
 #include <memory>
 #include <new>
 #include <type_traits>
+#include <utility>
 
+#include <hpc/core/ring_storage.hpp>
 #include <hpc/support/cache_line.hpp>
 
 namespace hpc::core {
@@ -25,23 +27,30 @@ namespace hpc::core {
 //    semantics. Most index arithmetic is relaxed.
 //  - Size/empty/full queries are intentionally approximate under concurrency
 //    and are meant for observability, not correctness.
+//  - Batch drains claim a run of published slots with a single CAS on the
+//    head index and prefetch ahead while consuming them.
+//  - Cell memory and the indices come from a storage policy (ring_storage.hpp);
+//    numa_ring_buffer.hpp provides a NUMA-homed variant.
 
-template <class T>
+template <class T, class Storage = heap_ring_storage>
 class mpmc_ring_buffer {
     static_assert(std::is_nothrow_destructible_v<T>,
                   "T must be nothrow destructible for lock-free teardown");
 
 public:
-    explicit mpmc_ring_buffer(std::size_t capacity)
+    // Default number of slots the drain path prefetches ahead of the consumer.
+    static constexpr std::size_t default_prefetch_distance = 4;
+
+    // Extra arguments go to the storage policy, e.g. the NUMA node of a
+    // numa_mpmc_ring_buffer.
+    template <class... StorageArgs>
+    explicit mpmc_ring_buffer(std::size_t capacity, StorageArgs&&... storage_args)
         : capacity_(round_up_to_power_of_two(capacity))
         , mask_(capacity_ - 1)
-        , cells_(static_cast<cell*>(::operator new[](capacity_ * sizeof(cell))))
+        , storage_(capacity_ * sizeof(cell), alignof(cell), std::forward<StorageArgs>(storage_args)...)
+        , cells_(reinterpret_cast<cell*>(storage_.data()))
     {
-        // Initialize per-slot sequence numbers so that slot i is initially
-        // observed as empty by producers (seq == i).
-        for (std::size_t i = 0; i < capacity_; ++i) {
-            ::new (static_cast<void*>(cells_ + i)) cell{i};
-        }
+        init_cells();
     }
 
     ~mpmc_ring_buffer()
@@ -52,7 +61,6 @@ public:
         for (std::size_t i = 0; i < capacity_; ++i) {
             cells_[i].~cell();
         }
-        ::operator delete[](cells_);
     }
 
     mpmc_ring_buffer(const mpmc_ring_buffer&) = delete;
@@ -63,17 +71,20 @@ public:
 
     std::size_t capacity() const noexcept { return capacity_; }
 
+    // NUMA node the ring's memory is bound to, or -1 if unbound.
+    int numa_node() const noexcept { return storage_.numa_node(); }
+
     bool empty() const noexcept
     {
-        auto head = head_.value.load(std::memory_order_relaxed);
-        auto tail = tail_.value.load(std::memory_order_relaxed);
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
         return head == tail;
     }
 
     // Approximate: can return false negatives under contention.
     bool full() const noexcept
     {
-        auto tail = tail_.value.load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
         const cell& c = cells_[tail & mask_];
         auto seq = c.sequence.load(std::memory_order_acquire);
         return seq < tail;
@@ -81,41 +92,17 @@ public:
 
     std::size_t approximate_size() const noexcept
     {
-        auto head = head_.value.load(std::memory_order_relaxed);
-        auto tail = tail_.value.load(std::memory_order_relaxed);
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
         return tail - head;
     }
 
     template <class... Args>
     bool try_emplace(Args&&... args)
     {
-        index_type tail = tail_.value.load(std::memory_order_relaxed);
-        for (;;) {
-            cell& c = cells_[tail & mask_];
-            std::size_t seq = c.sequence.load(std::memory_order_acquire);
-            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail);
-
-            if (diff == 0) {
-                // Slot is free; try to claim this tail index.
-                if (tail_.value.compare_exchange_weak(
-                        tail, tail + 1,
-                        std::memory_order_relaxed,
-                        std::memory_order_relaxed)) {
-                    // We own this slot.
-                    ::new (static_cast<void*>(std::addressof(c.storage))) T(std::forward<Args>(args)...);
-                    // Publish element: sequence moves to tail + 1.
-                    c.sequence.store(tail + 1, std::memory_order_release);
-                    return true;
-                }
-                // CAS failed: another producer moved tail; reload and retry.
-            } else if (diff < 0) {
-                // This slot sequence is behind the tail; the queue is full.
-                return false;
-            }
-
-            // Another producer beat us to this slot; reload tail and try again.
-            tail = tail_.value.load(std::memory_order_relaxed);
-        }
+        return try_produce([&](void* slot) {
+            ::new (slot) T(std::forward<Args>(args)...);
+        });
     }
 
     bool try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
@@ -128,9 +115,11 @@ public:
         return try_emplace(std::move(value));
     }
 
+    // If the move assignment into out throws, the claimed element is
+    // destroyed and dropped; the ring stays usable.
     bool try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>)
     {
-        index_type head = head_.value.load(std::memory_order_relaxed);
+        index_type head = storage_.head().load(std::memory_order_relaxed);
         for (;;) {
             cell& c = cells_[head & mask_];
             std::size_t seq = c.sequence.load(std::memory_order_acquire);
@@ -138,17 +127,25 @@ public:
 
             if (diff == 0) {
                 // Element is available; try to claim this head index.
-                if (head_.value.compare_exchange_weak(
+                if (storage_.head().compare_exchange_weak(
                         head, head + 1,
                         std::memory_order_relaxed,
                         std::memory_order_relaxed)) {
-                    // We own this slot.
-                    T* value_ptr = reinterpret_cast<T*>(std::addressof(c.storage));
-                    out = std::move(*value_ptr);
-                    value_ptr->~T();
-                    // Mark slot as empty for the next cycle: advance sequence
-                    // by capacity_.
-                    c.sequence.store(head + capacity_, std::memory_order_release);
+                    // We own this slot. Destroy the element and mark the slot
+                    // empty for the next cycle (sequence advances by
+                    // capacity_) even if the move throws: the claim cannot be
+                    // undone, so the element is dropped rather than the slot
+                    // being lost for good.
+                    struct release_cell {
+                        cell& owned;
+                        index_type next_sequence;
+                        ~release_cell()
+                        {
+                            reinterpret_cast<T*>(std::addressof(owned.storage))->~T();
+                            owned.sequence.store(next_sequence, std::memory_order_release);
+                        }
+                    } released{c, head + capacity_};
+                    out = std::move(*reinterpret_cast<T*>(std::addressof(c.storage)));
                     return true;
                 }
                 // CAS failed, someone else moved head; reload and retry.
@@ -157,7 +154,7 @@ public:
                 return false;
             }
 
-            head = head_.value.load(std::memory_order_relaxed);
+            head = storage_.head().load(std::memory_order_relaxed);
         }
     }
 
@@ -170,6 +167,8 @@ public:
         return pushed;
     }
 
+    // Pops one element at a time; if a move assignment throws, the elements
+    // before it are in dst and the one it threw on is dropped (see try_pop).
     std::size_t try_pop_batch(T* dst, std::size_t count)
     {
         std::size_t popped = 0;
@@ -179,9 +178,112 @@ public:
         return popped;
     }
 
+    // Push a trivially copyable value using non-temporal stores, for large
+    // payloads the producer will not read back.
+    bool try_push_streaming(const T& value) noexcept
+        requires std::is_trivially_copyable_v<T>
+    {
+        return try_produce([&value](void* slot) {
+            hpc::support::stream_copy(slot, std::addressof(value), sizeof(T));
+            // Streaming stores are weakly ordered; fence before the sequence
+            // release publishes the slot.
+            hpc::support::store_fence();
+        });
+    }
+
+    // Consume up to max_count elements, invoking consume(T&) on each before
+    // destroying it. The run of consecutive published slots at the head is
+    // claimed with one CAS, so elements are handed out in FIFO order and no
+    // other consumer can interleave within the batch. While consuming, the
+    // slot prefetch_distance positions ahead is prefetched (0 disables it).
+    // Returns the number consumed. consume must not throw: the whole run is
+    // already claimed, and cells left unreleased would wedge the ring.
+    template <class F>
+    std::size_t drain(F&& consume,
+                      std::size_t max_count = static_cast<std::size_t>(-1),
+                      std::size_t prefetch_distance = default_prefetch_distance)
+        requires std::is_nothrow_invocable_v<F&, T&>
+    {
+        index_type head = storage_.head().load(std::memory_order_relaxed);
+        std::size_t n = 0;
+        for (;;) {
+            // Count published slots starting at head. The acquire loads pair
+            // with the producers' release stores of the sequence.
+            const std::size_t limit = max_count < capacity_ ? max_count : capacity_;
+            n = 0;
+            while (n < limit) {
+                const cell& c = cells_[(head + n) & mask_];
+                if (c.sequence.load(std::memory_order_acquire) != head + n + 1) break;
+                ++n;
+            }
+            if (n == 0) {
+                return 0;
+            }
+            if (storage_.head().compare_exchange_weak(
+                    head, head + n,
+                    std::memory_order_relaxed,
+                    std::memory_order_relaxed)) {
+                break;
+            }
+            // Another consumer moved head; head now holds its value, rescan.
+        }
+
+        const std::size_t warmup = prefetch_distance < n ? prefetch_distance : n;
+        for (std::size_t i = 0; i < warmup; ++i) {
+            hpc::support::prefetch_range_for_read(std::addressof(cells_[(head + i) & mask_].storage), sizeof(T));
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (prefetch_distance != 0 && i + prefetch_distance < n) {
+                hpc::support::prefetch_range_for_read(
+                    std::addressof(cells_[(head + i + prefetch_distance) & mask_].storage), sizeof(T));
+            }
+            cell& c = cells_[(head + i) & mask_];
+            T* value_ptr = reinterpret_cast<T*>(std::addressof(c.storage));
+            consume(*value_ptr);
+            value_ptr->~T();
+            c.sequence.store(head + i + capacity_, std::memory_order_release);
+        }
+        return n;
+    }
+
 private:
     using index_type = std::size_t;
 
+    // Claim a free slot at the tail, let fill(void*) construct the element in
+    // it, then publish it by advancing the slot's sequence.
+    template <class Fill>
+    bool try_produce(Fill&& fill)
+    {
+        index_type tail = storage_.tail().load(std::memory_order_relaxed);
+        for (;;) {
+            cell& c = cells_[tail & mask_];
+            std::size_t seq = c.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail);
+
+            if (diff == 0) {
+                // Slot is free; try to claim this tail index.
+                if (storage_.tail().compare_exchange_weak(
+                        tail, tail + 1,
+                        std::memory_order_relaxed,
+                        std::memory_order_relaxed)) {
+                    // We own this slot.
+                    fill(static_cast<void*>(std::addressof(c.storage)));
+                    // Publish element: sequence moves to tail + 1.
+                    c.sequence.store(tail + 1, std::memory_order_release);
+                    return true;
+                }
+                // CAS failed: another producer moved tail; reload and retry.
+            } else if (diff < 0) {
+                // This slot sequence is behind the tail; the queue is full.
+                return false;
+            }
+
+            // Another producer beat us to this slot; reload tail and try again.
+            tail = storage_.tail().load(std::memory_order_relaxed);
+        }
+    }
+
     struct cell {
         std::atomic<index_type> sequence;
         alignas(hpc::support::cache_line_size) std::aligned_storage_t<sizeof(T), alignof(T)> storage;
@@ -189,10 +291,6 @@ private:
         explicit cell(index_type seq) noexcept : sequence(seq) {}
     };
 
-    struct alignas(hpc::support::cache_line_size) padded_index {
-        std::atomic<index_type> value{0};
-    };
-
     static std::size_t round_up_to_power_of_two(std::size_t n) noexcept
     {
         if (n < 2) return 2;
@@ -203,12 +301,19 @@ private:
         return n + 1;
     }
 
+    void init_cells() noexcept
+    {
+        // Initialize per-slot sequence numbers so that slot i is initially
+        // observed as empty by producers (seq == i).
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            ::new (static_cast<void*>(cells_ + i)) cell{i};
+        }
+    }
+
     std::size_t capacity_{}; // usable capacity (power-of-two)
     std::size_t mask_{};
 
-    padded_index head_{}; // consumer index
-    padded_index tail_{}; // producer index
-
+    Storage storage_; // cell memory and both indices
     cell* cells_{};
 };
 
@@ -1,29 +1,70 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
+#include <future>
+#include <span>
+#include <vector>
 
 #include <hpc/core/arena_allocator.hpp>
 
 namespace hpc::core {
 
-// NUMA-aware arena: a thin wrapper that allows binding the underlying
-// arena storage to a specific NUMA node where the platform supports it.
+// NUMA-aware arena: a bump arena over a fresh anonymous mapping whose memory
+// policy is set before any page is touched.
 //
-// On platforms without NUMA APIs available (including macOS), this class
-// gracefully degrades to a regular arena.
+// Policies:
+//  - local:      allocate on the node of the touching thread (MPOL_LOCAL).
+//  - bind:       only the given nodes (MPOL_BIND); the classic "home this
+//                structure on node N".
+//  - preferred:  the first given node if it has free memory, else anywhere
+//                (MPOL_PREFERRED); any further nodes are ignored.
+//  - interleave: round-robin pages across the given nodes (MPOL_INTERLEAVE),
+//                for large shared read-mostly tables that every socket reads
+//                and that should use all memory controllers' bandwidth.
+//
+// The policy applies to the whole mapping, which the arena only first-touches
+// when callers write to it. verify_placement() reports where the pages
+// actually landed. On platforms without NUMA APIs available (including
+// macOS), this class gracefully degrades to a regular arena.
+
+enum class numa_policy {
+    local,
+    bind,
+    preferred,
+    interleave,
+};
+
+// Pages of a region by node, from move_pages().
+struct numa_placement {
+    std::vector<std::size_t> pages_per_node; // index = node id
+    std::size_t pages_not_present = 0;       // never touched (or swapped out)
+    std::size_t pages_total = 0;
+};
+
+struct numa_migration_result {
+    std::size_t bytes_moved = 0;
+    std::size_t pages_failed = 0;      // resident pages the kernel could not move
+    std::chrono::nanoseconds elapsed{};
+    bool ok = false;                   // false if NUMA is unavailable or the new policy was rejected
+};
 
 class numa_arena {
 public:
+    // Bound to preferred_node (MPOL_BIND); -1 means no specific node.
     explicit numa_arena(std::size_t size_bytes,
                         int preferred_node = -1) noexcept;
 
+    // Explicit policy over a node set (ignored for local).
+    numa_arena(std::size_t size_bytes, numa_policy policy, std::span<const int> nodes) noexcept;
+
     numa_arena(const numa_arena&) = delete;
     numa_arena& operator=(const numa_arena&) = delete;
 
     numa_arena(numa_arena&&) = delete;
     numa_arena& operator=(numa_arena&&) = delete;
 
-    ~numa_arena() = default;
+    ~numa_arena();
 
     [[nodiscard]] void* allocate(std::size_t size, std::size_t align) noexcept
     {
@@ -34,15 +75,45 @@ public:
 
     std::size_t capacity() const noexcept { return arena_.capacity(); }
 
+    // Node the arena is bound or preferred to; -1 if unbound, interleaved,
+    // or the policy could not be applied.
     int node() const noexcept { return node_; }
 
+    numa_policy policy() const noexcept { return policy_; }
+
+    // False if the kernel rejected the policy (or NUMA is unavailable); the
+    // memory is then placed by the default policy.
+    bool policy_applied() const noexcept { return policy_applied_; }
+
+    // Per-node page histogram of the whole mapping (not just the used part).
+    numa_placement verify_placement() const;
+
+    // Move resident pages to `node` (move_pages) and rebind the mapping there
+    // so later first touches follow. With chunk_bytes != 0 the pages move one
+    // chunk per system call, yielding in between, which bounds each stall
+    // when run off the critical path. The arena stays usable throughout;
+    // a page being moved is briefly write-protected by the kernel.
+    numa_migration_result migrate_to_node(int node, std::size_t chunk_bytes = 0);
+
+    // migrate_to_node() on a background thread. node() and policy() are
+    // updated by the migration, so read them only after the future is ready.
+    std::future<numa_migration_result> migrate_to_node_async(int node, std::size_t chunk_bytes = 0)
+    {
+        return std::async(std::launch::async, [this, node, chunk_bytes] { return migrate_to_node(node, chunk_bytes); });
+    }
+
     hpc::core::arena& underlying() noexcept { return arena_; }
     const hpc::core::arena& underlying() const noexcept { return arena_; }
 
 private:
-    hpc::core::arena arena_;
+    void map_and_apply(std::size_t size_bytes, std::span<const int> nodes) noexcept;
+
+    hpc::core::arena arena_{nullptr, 0};
+    void* mapping_ = nullptr;
+    std::size_t mapping_bytes_ = 0;
     int node_ = -1; // -1 == no specific NUMA binding
+    numa_policy policy_ = numa_policy::local;
+    bool policy_applied_ = false;
 };
 
 } // namespace hpc::core
-
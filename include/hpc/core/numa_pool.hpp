@@ -1,23 +1,25 @@
 #pragma once
 
 #include <cstddef>
+#include <new>
 
 #include <hpc/core/pool_allocator.hpp>
 #include <hpc/core/numa_arena.hpp>
 
 namespace hpc::core {
 
-// NUMA-aware fixed-size pool. Internally uses a numa_arena as a hint for
-// placement, but delegates block management to fixed_pool. On platforms
-// without NUMA support this reduces to a regular fixed_pool.
+// NUMA-aware fixed-size pool: fixed_pool block management over storage
+// carved from a numa_arena, so the blocks live (and migrate) with the arena.
+// On platforms without NUMA support this reduces to a regular fixed_pool.
+// Construction throws std::bad_alloc if the arena cannot provide the blocks.
 
 template <class T>
 class numa_pool {
 public:
     explicit numa_pool(std::size_t capacity,
                        int preferred_node = -1)
-        : arena_(capacity * sizeof(T), preferred_node)
-        , pool_(sizeof(T), capacity)
+        : arena_(capacity * block_size, preferred_node)
+        , pool_(allocate_blocks(arena_, capacity), block_size, capacity)
     {}
 
     numa_pool(const numa_pool&) = delete;
@@ -30,13 +32,47 @@ public:
 
     void deallocate(T* ptr) noexcept { pool_.deallocate(ptr); }
 
+    std::size_t allocate_bulk(T** out, std::size_t n) noexcept
+    {
+        return pool_.allocate_bulk(reinterpret_cast<void**>(out), n);
+    }
+
+    void deallocate_bulk(T* const* in, std::size_t n) noexcept
+    {
+        pool_.deallocate_bulk(reinterpret_cast<void* const*>(in), n);
+    }
+
     std::size_t capacity() const noexcept { return pool_.capacity(); }
 
     int node() const noexcept { return arena_.node(); }
 
+    // Move the pool's pages to `node`; see numa_arena::migrate_to_node.
+    numa_migration_result migrate_to_node(int node, std::size_t chunk_bytes = 0)
+    {
+        return arena_.migrate_to_node(node, chunk_bytes);
+    }
+
+    std::future<numa_migration_result> migrate_to_node_async(int node, std::size_t chunk_bytes = 0)
+    {
+        return arena_.migrate_to_node_async(node, chunk_bytes);
+    }
+
+    numa_placement verify_placement() const { return arena_.verify_placement(); }
+
 private:
-    numa_arena arena_;   // currently only used to bias placement; could be
-                         // used for backing storage in a future refinement.
+    // Blocks also hold the free-list link while free.
+    static constexpr std::size_t block_align = alignof(T) < alignof(void*) ? alignof(void*) : alignof(T);
+    static constexpr std::size_t block_size =
+        ((sizeof(T) < sizeof(void*) ? sizeof(void*) : sizeof(T)) + block_align - 1) / block_align * block_align;
+
+    static void* allocate_blocks(numa_arena& arena, std::size_t capacity)
+    {
+        void* p = arena.allocate(capacity * block_size, block_align);
+        if (!p) throw std::bad_alloc();
+        return p;
+    }
+
+    numa_arena arena_;   // backing storage, placed on preferred_node
     fixed_pool pool_;
 };
 
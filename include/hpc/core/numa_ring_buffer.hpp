@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#include <hpc/core/mpmc_ring_buffer.hpp>
+#include <hpc/core/numa_arena.hpp>
+#include <hpc/core/ring_buffer.hpp>
+#include <hpc/core/ring_storage.hpp>
+
+namespace hpc::core {
+
+// NUMA-homed rings: slot storage and the head/tail index lines are carved
+// from a numa_arena bound to one node.
+//
+// Design notes:
+//  - For cross-socket links, home the ring on the consumer's node: slot
+//    reads and the consumer's head updates stay local, and the producer's
+//    remote slot writes drain through its store buffer instead of stalling
+//    loads. MPMC cells are first touched by the ring after binding.
+//  - The indices live in the arena, so each access goes through a pointer;
+//    rings that are not NUMA-homed keep the default heap_ring_storage.
+//  - A negative node, or a build without NUMA support, yields unbound
+//    memory; numa_node() then reports -1.
+
+class numa_ring_storage {
+public:
+    numa_ring_storage(std::size_t bytes, std::size_t alignment, int numa_node)
+        : arena_(2 * sizeof(padded_ring_index) + bytes + 2 * alignment, numa_node)
+    {
+        // Each index gets its own line ahead of the slots.
+        head_ = ::new (allocate(sizeof(padded_ring_index), alignof(padded_ring_index))) padded_ring_index{};
+        tail_ = ::new (allocate(sizeof(padded_ring_index), alignof(padded_ring_index))) padded_ring_index{};
+        data_ = static_cast<std::byte*>(allocate(bytes, alignment));
+    }
+
+    numa_ring_storage(const numa_ring_storage&) = delete;
+    numa_ring_storage& operator=(const numa_ring_storage&) = delete;
+
+    std::byte* data() const noexcept { return data_; }
+
+    std::atomic<std::size_t>& head() noexcept { return head_->value; }
+    const std::atomic<std::size_t>& head() const noexcept { return head_->value; }
+    std::atomic<std::size_t>& tail() noexcept { return tail_->value; }
+    const std::atomic<std::size_t>& tail() const noexcept { return tail_->value; }
+
+    int numa_node() const noexcept { return arena_.node(); }
+
+private:
+    void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        void* p = arena_.allocate(bytes, alignment);
+        if (!p) throw std::bad_alloc();
+        return p;
+    }
+
+    numa_arena arena_;
+    padded_ring_index* head_{};
+    padded_ring_index* tail_{};
+    std::byte* data_{};
+};
+
+// numa_spsc_ring_buffer<T> q(capacity, numa_node);
+template <class T>
+using numa_spsc_ring_buffer = spsc_ring_buffer<T, numa_ring_storage>;
+
+template <class T>
+using numa_mpmc_ring_buffer = mpmc_ring_buffer<T, numa_ring_storage>;
+
+} // namespace hpc::core
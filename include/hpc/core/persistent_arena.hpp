@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <hpc/core/arena_allocator.hpp>
+#include <hpc/support/noncopyable.hpp>
+
+namespace hpc::core {
+
+// Bump-pointer arena backed by a memory-mapped file, so that large in-memory
+// state survives a process restart: a restarted process remaps the file and
+// finds its data where it left it instead of rebuilding it.
+//
+// Design notes:
+//  - The file starts with a small header (magic, caller-defined layout
+//    version, data offset, capacity, bump offset, root offset,
+//    clean-shutdown flag). A new file places the data region one page in
+//    (one huge page on hugetlbfs), so it is aligned to the mapping granule of
+//    the system that created it; the offset is read back from the header.
+//  - The mapping address differs between runs, so data stored in the arena
+//    must not hold raw pointers into it. Use offsets (to_offset/from_offset)
+//    and publish the entry point of the data structure via set_root().
+//  - Files on hugetlbfs are detected and sized to a huge-page multiple.
+//  - The file is locked for the lifetime of the object; a second process
+//    opening the same file fails instead of corrupting it.
+//  - Allocation is not thread-safe, as with arena.
+
+struct persistent_arena_config {
+    std::string   path;                 // backing file (regular fs or hugetlbfs)
+    std::size_t   capacity = 0;         // data region bytes for a new file
+    std::uint32_t layout_version = 0;   // caller-defined data layout version
+    bool          create = true;        // create the file if it does not exist
+};
+
+#pragma pack(push, 8)
+struct persistent_arena_header {
+    std::uint64_t magic;
+    std::uint32_t format_version;  // version of this header
+    std::uint32_t layout_version;  // caller-defined
+    std::uint64_t data_offset;     // offset of the data region from the file start
+    std::uint64_t capacity;        // data region bytes
+    std::uint64_t used;            // bump offset within the data region
+    std::uint64_t root;            // file offset of the root object, 0 if unset
+    std::uint64_t clean_shutdown;  // 1 if the last session closed cleanly
+};
+#pragma pack(pop)
+
+class persistent_arena : private hpc::support::noncopyable {
+public:
+    // Offset from the start of the mapping; 0 is reserved for "null".
+    using offset_type = std::uint64_t;
+
+    // Opens (or creates) the backing file and maps it. Throws
+    // std::runtime_error if the file cannot be opened, mapped or locked, or
+    // if an existing file has a different magic or layout version.
+    explicit persistent_arena(const persistent_arena_config& cfg);
+    ~persistent_arena();
+
+    persistent_arena(persistent_arena&&) = delete;
+    persistent_arena& operator=(persistent_arena&&) = delete;
+
+    [[nodiscard]] void* allocate(std::size_t bytes,
+                                 std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+    // Discards all allocations and the root.
+    void reset() noexcept;
+
+    // True if the constructor remapped state left by a previous session.
+    bool restored() const noexcept { return restored_; }
+    // True if the previous session closed cleanly (always true for new files).
+    bool clean_shutdown() const noexcept { return previous_clean_; }
+
+    std::uint32_t layout_version() const noexcept { return header_->layout_version; }
+    std::size_t capacity() const noexcept { return static_cast<std::size_t>(header_->capacity); }
+    std::size_t used() const noexcept { return static_cast<std::size_t>(header_->used); }
+
+    offset_type to_offset(const void* p) const noexcept
+    {
+        return p ? static_cast<offset_type>(static_cast<const std::byte*>(p) - base_) : 0;
+    }
+
+    template <class T>
+    T* from_offset(offset_type off) const noexcept
+    {
+        return off ? reinterpret_cast<T*>(base_ + off) : nullptr;
+    }
+
+    void set_root(const void* p) noexcept { header_->root = to_offset(p); }
+
+    template <class T>
+    T* root() const noexcept { return from_offset<T>(header_->root); }
+
+    // Write dirty pages back to the file (msync). Throws on failure.
+    void flush();
+
+private:
+    int fd_{-1};
+    std::byte* base_{};
+    std::size_t mapped_size_{};
+    persistent_arena_header* header_{};
+    arena arena_;
+    bool restored_{false};
+    bool previous_clean_{true};
+};
+
+} // namespace hpc::core
@@ -5,28 +5,68 @@
 #include <new>
 #include <type_traits>
 
+#include <hpc/support/cache_line.hpp>
 #include <hpc/support/noncopyable.hpp>
 
 namespace hpc::core {
 
+// Slab coloring for fixed_pool. Elements are grouped into slabs of
+// `slab_elements`, and each slab is followed by one cache line of padding, so
+// successive slabs start one line further into the page (and into the L2
+// set stride). Without it, power-of-two element sizes such as 4 KiB put the
+// same field of every element in the same cache sets. slab_elements == 0
+// disables coloring.
+struct pool_coloring {
+    std::size_t slab_elements = 1;
+};
+
 // Fixed-size object pool with a free-list stored in freed blocks.
 class fixed_pool : private hpc::support::noncopyable {
 public:
     fixed_pool(std::size_t element_size, std::size_t element_count);
+
+    // Colored layout: costs one cache line per slab.
+    fixed_pool(std::size_t element_size, std::size_t element_count, pool_coloring coloring);
+
+    // Pool over caller-owned memory (e.g. a NUMA arena), which must hold
+    // element_count blocks of max(element_size, sizeof(void*)) bytes and
+    // outlive the pool.
+    fixed_pool(void* buffer, std::size_t element_size, std::size_t element_count);
+
     ~fixed_pool();
 
     void* allocate();
     void deallocate(void* p) noexcept;
 
+    // Take up to n blocks off the free list with a single head update.
+    // Returns the number written to out (fewer than n if the pool runs dry).
+    std::size_t allocate_bulk(void** out, std::size_t n) noexcept;
+
+    // Link the n blocks into a chain and splice it onto the free list in one
+    // step. Entries must be non-null.
+    void deallocate_bulk(void* const* in, std::size_t n) noexcept;
+
     std::size_t capacity() const noexcept { return element_count_; }
 
+    // Bytes reserved for the pool, including coloring padding.
+    std::size_t storage_bytes() const noexcept { return storage_bytes_; }
+
 private:
     struct node { node* next; };
 
+    std::byte* element_at(std::size_t i) const noexcept
+    {
+        return storage_ + i * element_size_ + (i / slab_elements_) * color_step_;
+    }
+
     std::size_t element_size_{};
     std::size_t element_count_{};
+    std::size_t slab_elements_{1};
+    std::size_t color_step_{};     // 0 (uncolored) or one cache line
+    std::size_t storage_bytes_{};
     std::byte* storage_{};
     node* free_list_{};
+    bool owns_storage_{true};
 };
 
 // STL-style allocator on top of fixed_pool.
@@ -50,6 +90,17 @@ public:
 
     void deallocate(T* p, std::size_t) noexcept { pool_->deallocate(p); }
 
+    // Single-object blocks in bulk; see fixed_pool::allocate_bulk.
+    std::size_t allocate_bulk(T** out, std::size_t n) noexcept
+    {
+        return pool_->allocate_bulk(reinterpret_cast<void**>(out), n);
+    }
+
+    void deallocate_bulk(T* const* in, std::size_t n) noexcept
+    {
+        pool_->deallocate_bulk(reinterpret_cast<void* const*>(in), n);
+    }
+
     template <class U>
     bool operator==(const pool_allocator<U>& rhs) const noexcept { return pool_ == rhs.pool_; }
     template <class U>
@@ -3,10 +3,12 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <memory>
 #include <new>
+#include <span>
 #include <type_traits>
+#include <utility>
 
+#include <hpc/core/ring_storage.hpp>
 #include <hpc/support/cache_line.hpp>
 
 namespace hpc::core {
@@ -14,74 +16,86 @@ namespace hpc::core {
 // Single-producer single-consumer ring buffer.
 //
 // Design notes:
-//  - Indices are placed on separate cache lines to avoid false sharing.
+//  - Indices are padded apart by destructive_interference_size (128 bytes on
+//    x86, past the adjacent-line prefetcher) to avoid false sharing.
 //  - Capacity is rounded up to the next power-of-two so index wrap-around
 //    uses a cheap bitwise AND instead of modulo.
 //  - Producer publishes elements with release semantics; consumer observes
 //    them with acquire semantics. Other loads can be relaxed.
 //  - Provides batch APIs and zero-copy slot access to amortize fences and
 //    avoid extra copies in the hot path.
+//  - Batch drains prefetch a configurable number of slots ahead of the one
+//    being consumed so a long backlog is not a chain of demand misses.
+//  - Streaming pushes copy trivially copyable payloads with non-temporal
+//    stores, keeping large messages out of the producer's cache.
+//  - Slot memory and the indices come from a storage policy (ring_storage.hpp).
+//    The default keeps the indices as direct members; numa_ring_buffer.hpp
+//    provides a NUMA-homed variant.
 
-template <class T>
+template <class T, class Storage = heap_ring_storage>
 class spsc_ring_buffer {
     static_assert(std::is_nothrow_destructible_v<T>,
                   "T must be nothrow destructible for lock-free teardown");
 
 public:
-    explicit spsc_ring_buffer(std::size_t capacity)
+    // Default number of slots the drain path prefetches ahead of the consumer.
+    static constexpr std::size_t default_prefetch_distance = 4;
+
+    // Extra arguments go to the storage policy, e.g. the NUMA node of a
+    // numa_spsc_ring_buffer.
+    template <class... StorageArgs>
+    explicit spsc_ring_buffer(std::size_t capacity, StorageArgs&&... storage_args)
         : storage_capacity_(round_up_to_power_of_two(capacity + 1))
         , mask_(storage_capacity_ - 1)
-        , storage_(static_cast<std::byte*>(::operator new[](storage_capacity_ * sizeof(T))))
+        , storage_(storage_capacity_ * sizeof(T), static_cast<std::size_t>(storage_alignment),
+                   std::forward<StorageArgs>(storage_args)...)
     {
     }
 
-    ~spsc_ring_buffer()
-    {
-        // In SPSC usage, producer and consumer are expected to have drained the
-        // queue before destruction; we do not walk remaining elements.
-        ::operator delete[](storage_);
-    }
+    // In SPSC usage, producer and consumer are expected to have drained the
+    // queue before destruction; we do not walk remaining elements.
+    ~spsc_ring_buffer() = default;
 
     spsc_ring_buffer(const spsc_ring_buffer&) = delete;
     spsc_ring_buffer& operator=(const spsc_ring_buffer&) = delete;
 
     bool try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
     {
-        auto tail = tail_.value.load(std::memory_order_relaxed);
-        auto head = head_.value.load(std::memory_order_acquire);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
+        auto head = storage_.head().load(std::memory_order_acquire);
         if (distance(tail, head) == capacity()) {
             return false; // full
         }
         T* slot = element_at(tail);
         ::new (static_cast<void*>(slot)) T(value);
-        tail_.value.store(next(tail), std::memory_order_release);
+        storage_.tail().store(next(tail), std::memory_order_release);
         return true;
     }
 
     bool try_push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
     {
-        auto tail = tail_.value.load(std::memory_order_relaxed);
-        auto head = head_.value.load(std::memory_order_acquire);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
+        auto head = storage_.head().load(std::memory_order_acquire);
         if (distance(tail, head) == capacity()) {
             return false;
         }
         T* slot = element_at(tail);
         ::new (static_cast<void*>(slot)) T(std::move(value));
-        tail_.value.store(next(tail), std::memory_order_release);
+        storage_.tail().store(next(tail), std::memory_order_release);
         return true;
     }
 
     bool try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>)
     {
-        auto head = head_.value.load(std::memory_order_relaxed);
-        auto tail = tail_.value.load(std::memory_order_acquire);
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_acquire);
         if (head == tail) {
             return false; // empty
         }
         T* slot = element_at(head);
         out = std::move(*slot);
         slot->~T();
-        head_.value.store(next(head), std::memory_order_release);
+        storage_.head().store(next(head), std::memory_order_release);
         return true;
     }
 
@@ -96,17 +110,97 @@ public:
 
     std::size_t try_pop_batch(T* dst, std::size_t count)
     {
-        std::size_t popped = 0;
-        for (; popped < count; ++popped) {
-            if (!try_pop(dst[popped])) break;
+        return drain([&dst](T& value) { *dst++ = std::move(value); }, count);
+    }
+
+    // Consume up to max_count elements in place, invoking consume(T&) on each
+    // in FIFO order before destroying it. The producer index is loaded once
+    // and the consumer index published once for the whole batch, and the slot
+    // prefetch_distance positions ahead is prefetched while the current one is
+    // processed (0 disables prefetching). Returns the number consumed.
+    // If consume throws, the elements before it are released and the one it
+    // threw on stays at the head, as with try_pop.
+    template <class F>
+    std::size_t drain(F&& consume,
+                      std::size_t max_count = static_cast<std::size_t>(-1),
+                      std::size_t prefetch_distance = default_prefetch_distance)
+    {
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_acquire);
+        const std::size_t available = distance(tail, head);
+        const std::size_t n = available < max_count ? available : max_count;
+        if (n == 0) {
+            return 0;
+        }
+
+        // Warm up the prefetch window; afterwards each iteration issues the
+        // prefetch for the slot prefetch_distance ahead.
+        const std::size_t warmup = prefetch_distance < n ? prefetch_distance : n;
+        for (std::size_t i = 0; i < warmup; ++i) {
+            hpc::support::prefetch_range_for_read(element_at(head + i), sizeof(T));
+        }
+
+        // Publishes the consumed prefix on return and on unwind.
+        struct release_consumed {
+            spsc_ring_buffer& ring;
+            index_type head;
+            std::size_t count = 0;
+            ~release_consumed()
+            {
+                if (count != 0) {
+                    ring.storage_.head().store((head + count) & ring.mask_, std::memory_order_release);
+                }
+            }
+        } released{*this, head};
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (prefetch_distance != 0 && i + prefetch_distance < n) {
+                hpc::support::prefetch_range_for_read(element_at(head + i + prefetch_distance), sizeof(T));
+            }
+            T* slot = element_at(head + i);
+            consume(*slot);
+            slot->~T();
+            ++released.count;
+        }
+        return n;
+    }
+
+    // Push a trivially copyable value using non-temporal stores. Meant for
+    // large payloads the producer will not read back; for small messages the
+    // regular try_push is usually cheaper.
+    bool try_push_streaming(const T& value) noexcept
+        requires std::is_trivially_copyable_v<T>
+    {
+        return try_push_batch_streaming(&value, 1) == 1;
+    }
+
+    // Batch form of try_push_streaming: a single fence and a single release
+    // store of the producer index cover the whole batch.
+    std::size_t try_push_batch_streaming(const T* src, std::size_t count) noexcept
+        requires std::is_trivially_copyable_v<T>
+    {
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
+        auto head = storage_.head().load(std::memory_order_acquire);
+        const std::size_t free_slots = capacity() - distance(tail, head);
+        const std::size_t n = free_slots < count ? free_slots : count;
+        if (n == 0) {
+            return 0;
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            hpc::support::stream_copy(element_at(tail + i), src + i, sizeof(T));
         }
-        return popped;
+
+        // Streaming stores are weakly ordered; fence them before publishing.
+        hpc::support::store_fence();
+        storage_.tail().store((tail + n) & mask_, std::memory_order_release);
+        return n;
     }
 
     T* try_acquire_producer_slot()
     {
-        auto tail = tail_.value.load(std::memory_order_relaxed);
-        auto head = head_.value.load(std::memory_order_acquire);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
+        auto head = storage_.head().load(std::memory_order_acquire);
         if (distance(tail, head) == capacity()) {
             return nullptr;
         }
@@ -115,14 +209,14 @@ public:
 
     void commit_producer_slot()
     {
-        auto tail = tail_.value.load(std::memory_order_relaxed);
-        tail_.value.store(next(tail), std::memory_order_release);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
+        storage_.tail().store(next(tail), std::memory_order_release);
     }
 
     T* try_acquire_consumer_slot()
     {
-        auto head = head_.value.load(std::memory_order_relaxed);
-        auto tail = tail_.value.load(std::memory_order_acquire);
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_acquire);
         if (head == tail) {
             return nullptr;
         }
@@ -131,26 +225,78 @@ public:
 
     void release_consumer_slot()
     {
-        auto head = head_.value.load(std::memory_order_relaxed);
-        head_.value.store(next(head), std::memory_order_release);
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        storage_.head().store(next(head), std::memory_order_release);
+    }
+
+    // Batch forms of the zero-copy slot API: fill `slots` with up to
+    // slots.size() free (producer) or readable (consumer) slots in ring order
+    // and return how many were available; then commit or release at most that
+    // many. Lets a system call such as recvmmsg fill several slots at once.
+    std::size_t try_acquire_producer_slots(std::span<T*> slots) noexcept
+    {
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
+        auto head = storage_.head().load(std::memory_order_acquire);
+        const std::size_t free_slots = capacity() - distance(tail, head);
+        const std::size_t n = free_slots < slots.size() ? free_slots : slots.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            slots[i] = element_at(tail + i);
+        }
+        return n;
+    }
+
+    void commit_producer_slots(std::size_t count) noexcept
+    {
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
+        storage_.tail().store((tail + count) & mask_, std::memory_order_release);
+    }
+
+    std::size_t try_acquire_consumer_slots(std::span<T*> slots) noexcept
+    {
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_acquire);
+        const std::size_t available = distance(tail, head);
+        const std::size_t n = available < slots.size() ? available : slots.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            slots[i] = element_at(head + i);
+        }
+        return n;
+    }
+
+    void release_consumer_slots(std::size_t count) noexcept
+    {
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        storage_.head().store((head + count) & mask_, std::memory_order_release);
     }
 
     bool empty() const noexcept
     {
-        auto head = head_.value.load(std::memory_order_relaxed);
-        auto tail = tail_.value.load(std::memory_order_relaxed);
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
         return head == tail;
     }
 
     bool full() const noexcept
     {
-        auto head = head_.value.load(std::memory_order_relaxed);
-        auto tail = tail_.value.load(std::memory_order_relaxed);
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
         return distance(tail, head) == capacity();
     }
 
+    // Occupancy snapshot; exact only when called from the producer or the
+    // consumer thread, and then only with respect to that side's own index.
+    std::size_t size() const noexcept
+    {
+        auto head = storage_.head().load(std::memory_order_relaxed);
+        auto tail = storage_.tail().load(std::memory_order_relaxed);
+        return distance(tail, head);
+    }
+
     std::size_t capacity() const noexcept { return storage_capacity_ - 1; }
 
+    // NUMA node the ring's memory is bound to, or -1 if unbound.
+    int numa_node() const noexcept { return storage_.numa_node(); }
+
 private:
     static std::size_t round_up_to_power_of_two(std::size_t n) noexcept
     {
@@ -164,29 +310,29 @@ private:
 
     using index_type = std::size_t;
 
-    struct alignas(hpc::support::cache_line_size) padded_index {
-        std::atomic<index_type> value{0};
-    };
+    // Slots must honour over-aligned T; cache-line alignment also keeps the
+    // first slot from sharing a line with unrelated heap data.
+    static constexpr std::align_val_t storage_alignment{
+        alignof(T) > hpc::support::cache_line_size ? alignof(T) : hpc::support::cache_line_size};
 
     std::size_t storage_capacity_{}; // underlying ring size; usable capacity is storage_capacity_-1
     std::size_t mask_{};
 
-    padded_index head_{}; // consumer-owned index (pop side)
-    padded_index tail_{}; // producer-owned index (push side)
-
-    std::byte* storage_{};
+    Storage storage_; // slot memory and both indices
 
     index_type next(index_type idx) const noexcept { return (idx + 1) & mask_; }
 
-    static std::size_t distance(index_type tail, index_type head) noexcept
+    // Number of occupied slots. Indices are stored already masked, so the
+    // difference must be masked too to stay correct once tail wraps past head.
+    std::size_t distance(index_type tail, index_type head) const noexcept
     {
-        return (tail - head) & static_cast<index_type>(-1);
+        return (tail - head) & mask_;
     }
 
     T* element_at(index_type idx) const noexcept
     {
         auto pos = (idx & mask_) * sizeof(T);
-        return reinterpret_cast<T*>(storage_ + pos);
+        return reinterpret_cast<T*>(storage_.data() + pos);
     }
 };
 
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#include <hpc/support/cache_line.hpp>
+
+namespace hpc::core {
+
+// Storage policies for spsc_ring_buffer and mpmc_ring_buffer.
+//
+// A policy owns the slot memory and the two ring indices. The interface:
+//   Storage(std::size_t bytes, std::size_t alignment, extra args...)
+//   std::byte* data() const noexcept;            // `bytes` of raw slot memory
+//   std::atomic<std::size_t>& head() noexcept;   // consumer index (+ const)
+//   std::atomic<std::size_t>& tail() noexcept;   // producer index (+ const)
+//   int numa_node() const noexcept;              // -1 if unbound
+// Slot construction and destruction stay with the ring.
+//
+// Design notes:
+//  - heap_ring_storage is the default: slots come from the heap and both
+//    indices are direct members, each on its own destructive-interference
+//    line, so an index access is a fixed offset from the ring.
+//  - Placement on a NUMA node lives in numa_ring_buffer.hpp, which is the
+//    only ring header that depends on numa_arena (and on linking hpc_core).
+
+struct alignas(hpc::support::destructive_interference_size) padded_ring_index {
+    std::atomic<std::size_t> value{0};
+};
+
+class heap_ring_storage {
+public:
+    heap_ring_storage(std::size_t bytes, std::size_t alignment)
+        : alignment_(alignment)
+        , data_(static_cast<std::byte*>(::operator new[](bytes, std::align_val_t{alignment})))
+    {
+    }
+
+    ~heap_ring_storage() { ::operator delete[](data_, std::align_val_t{alignment_}); }
+
+    heap_ring_storage(const heap_ring_storage&) = delete;
+    heap_ring_storage& operator=(const heap_ring_storage&) = delete;
+
+    std::byte* data() const noexcept { return data_; }
+
+    std::atomic<std::size_t>& head() noexcept { return head_.value; }
+    const std::atomic<std::size_t>& head() const noexcept { return head_.value; }
+    std::atomic<std::size_t>& tail() noexcept { return tail_.value; }
+    const std::atomic<std::size_t>& tail() const noexcept { return tail_.value; }
+
+    int numa_node() const noexcept { return -1; }
+
+private:
+    std::size_t alignment_;
+    std::byte* data_;
+
+    padded_ring_index head_{}; // consumer-owned index (pop side)
+    padded_ring_index tail_{}; // producer-owned index (push side)
+};
+
+} // namespace hpc::core
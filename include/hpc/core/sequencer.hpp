@@ -0,0 +1,241 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <hpc/core/backoff.hpp>
+#include <hpc/support/cache_line.hpp>
+
+namespace hpc::core {
+
+// Multi-producer, single-consumer sequencer: producers claim gap-free global
+// sequence numbers, write into the slot of that sequence, and publish it; the
+// consumer reads strictly in sequence order.
+//
+// Design notes:
+//  - Claiming is one fetch_add on a shared cursor, so the claim order is the
+//    total order; unlike mpmc_ring_buffer, a slot published early by a later
+//    claimer is not visible until every earlier sequence is published.
+//  - Each slot records which sequence it holds (published = sequence + 1,
+//    release). The consumer walks forward while the next slot carries the
+//    expected sequence and stalls only on the first missing one.
+//  - The consumer publishes its progress once per drained batch; producers
+//    gate on it so a claim never overwrites an unread slot. A blocking
+//    claim waits only when the ring is full: a backoff proportional to the
+//    number of slots the consumer must still free, then yielding.
+//  - Batch claims reserve a contiguous run of sequences, e.g. for a journal
+//    record spanning several slots.
+//  - A claimed sequence must always be published, or the consumer stalls on
+//    it for good. emplace() and try_push() therefore require T to be
+//    nothrow constructible from their arguments; with slot() and publish(),
+//    the caller must publish whatever happens.
+//  - Remaining elements are not destroyed on teardown, as with the rings.
+
+template <class T>
+class sequencer {
+    static_assert(std::is_nothrow_destructible_v<T>,
+                  "T must be nothrow destructible for lock-free teardown");
+
+public:
+    using sequence_type = std::uint64_t;
+
+    explicit sequencer(std::size_t capacity)
+        : capacity_(round_up_to_power_of_two(capacity))
+        , mask_(capacity_ - 1)
+        , cells_(static_cast<cell*>(::operator new[](capacity_ * sizeof(cell), std::align_val_t{alignof(cell)})))
+    {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            ::new (static_cast<void*>(cells_ + i)) cell{};
+        }
+    }
+
+    ~sequencer()
+    {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            cells_[i].~cell();
+        }
+        ::operator delete[](cells_, std::align_val_t{alignof(cell)});
+    }
+
+    sequencer(const sequencer&) = delete;
+    sequencer& operator=(const sequencer&) = delete;
+
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    // Producer side.
+
+    // Claim `count` consecutive sequences (1 <= count <= capacity) and return
+    // the first. Waits while the ring lacks room for the whole run.
+    sequence_type claim(std::size_t count = 1) noexcept
+    {
+        const sequence_type first = claim_.value.fetch_add(count, std::memory_order_relaxed);
+        const sequence_type last = first + count - 1;
+        proportional_backoff backoff(claim_wait_ns_per_slot);
+        for (;;) {
+            const sequence_type consumed = consumer_.value.load(std::memory_order_acquire);
+            if (last - consumed < capacity_) {
+                return first;
+            }
+            // Past the spin budget the consumer is likely descheduled; give
+            // up the core rather than spin against it.
+            if (!backoff.pause(last - consumed - capacity_ + 1)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // Non-blocking claim; fails if the run would overwrite unread slots.
+    bool try_claim(sequence_type& first, std::size_t count = 1) noexcept
+    {
+        sequence_type current = claim_.value.load(std::memory_order_relaxed);
+        do {
+            if (current + count - 1 - consumer_.value.load(std::memory_order_acquire) >= capacity_) {
+                return false;
+            }
+        } while (!claim_.value.compare_exchange_weak(current, current + count,
+                                                     std::memory_order_relaxed,
+                                                     std::memory_order_relaxed));
+        first = current;
+        return true;
+    }
+
+    // Raw storage for a claimed sequence; construct a T in it, then publish.
+    void* slot(sequence_type seq) noexcept
+    {
+        return static_cast<void*>(std::addressof(cells_[seq & mask_].storage));
+    }
+
+    void publish(sequence_type seq) noexcept
+    {
+        cells_[seq & mask_].published.store(seq + 1, std::memory_order_release);
+    }
+
+    void publish(sequence_type first, std::size_t count) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            publish(first + i);
+        }
+    }
+
+    // Claim, construct and publish; returns the assigned sequence.
+    template <class... Args>
+    sequence_type emplace(Args&&... args) noexcept
+        requires std::is_nothrow_constructible_v<T, Args&&...>
+    {
+        const sequence_type seq = claim();
+        ::new (slot(seq)) T(std::forward<Args>(args)...);
+        publish(seq);
+        return seq;
+    }
+
+    bool try_push(const T& value) noexcept
+        requires std::is_nothrow_copy_constructible_v<T>
+    {
+        sequence_type seq = 0;
+        if (!try_claim(seq)) {
+            return false;
+        }
+        ::new (slot(seq)) T(value);
+        publish(seq);
+        return true;
+    }
+
+    bool try_push(T&& value) noexcept
+        requires std::is_nothrow_move_constructible_v<T>
+    {
+        sequence_type seq = 0;
+        if (!try_claim(seq)) {
+            return false;
+        }
+        ::new (slot(seq)) T(std::move(value));
+        publish(seq);
+        return true;
+    }
+
+    // Consumer side.
+
+    // Consume up to max_count elements in sequence order, invoking
+    // consume(sequence_type, T&) on each before destroying it. Stops at the
+    // first sequence not yet published. The consumer cursor is published once
+    // for the batch. If consume throws, the elements before it are released
+    // and the one it threw on is read again next time. Returns the number
+    // consumed.
+    template <class F>
+    std::size_t drain(F&& consume, std::size_t max_count = static_cast<std::size_t>(-1))
+    {
+        // Publishes the consumed prefix on return and on unwind.
+        struct release_consumed {
+            padded_index& cursor;
+            sequence_type start;
+            std::size_t count = 0;
+            ~release_consumed()
+            {
+                if (count != 0) {
+                    cursor.value.store(start + count, std::memory_order_release);
+                }
+            }
+        } released{consumer_, consumer_.value.load(std::memory_order_relaxed)};
+
+        const sequence_type start = released.start;
+        const std::size_t limit = max_count < capacity_ ? max_count : capacity_;
+        for (std::size_t n = 0; n < limit; ++n) {
+            cell& c = cells_[(start + n) & mask_];
+            if (c.published.load(std::memory_order_acquire) != start + n + 1) break;
+            T* value = std::launder(reinterpret_cast<T*>(std::addressof(c.storage)));
+            consume(start + n, *value);
+            value->~T();
+            ++released.count;
+        }
+        return released.count;
+    }
+
+    bool try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        return drain([&out](sequence_type, T& value) { out = std::move(value); }, 1) == 1;
+    }
+
+    // Next sequence the consumer will read (the first missing one, if the
+    // consumer is caught up).
+    sequence_type next_sequence() const noexcept { return consumer_.value.load(std::memory_order_relaxed); }
+
+    // Sequences claimed so far (approximate under concurrency).
+    sequence_type claimed() const noexcept { return claim_.value.load(std::memory_order_relaxed); }
+
+private:
+    // Rough time for the consumer to drain one slot, for the full-ring wait.
+    static constexpr std::uint32_t claim_wait_ns_per_slot = 16;
+
+    struct cell {
+        std::atomic<sequence_type> published{0}; // sequence + 1 once written
+        alignas(hpc::support::cache_line_size) std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+    };
+
+    struct alignas(hpc::support::destructive_interference_size) padded_index {
+        std::atomic<sequence_type> value{0};
+    };
+
+    static std::size_t round_up_to_power_of_two(std::size_t n) noexcept
+    {
+        if (n < 2) return 2;
+        --n;
+        for (std::size_t i = 1; i < sizeof(std::size_t) * 8; i <<= 1) {
+            n |= n >> i;
+        }
+        return n + 1;
+    }
+
+    std::size_t capacity_{};
+    std::size_t mask_{};
+    cell* cells_{};
+
+    padded_index claim_{};    // next sequence to hand out (producers)
+    padded_index consumer_{}; // next sequence to read (consumer)
+};
+
+} // namespace hpc::core
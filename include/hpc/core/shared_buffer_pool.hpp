@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+
+#include <hpc/support/cache_line.hpp>
+#include <hpc/support/huge_pages.hpp>
+#include <hpc/support/noncopyable.hpp>
+
+namespace hpc::core {
+
+class shared_buffer_pool;
+
+namespace detail {
+
+// Per-buffer control block, kept apart from the payloads on its own cache
+// line so refcount traffic does not disturb payload reads.
+struct alignas(hpc::support::cache_line_size) shared_buffer_header {
+    std::atomic<std::uint32_t> refs{0};
+    std::uint32_t size{};           // payload bytes in use, set by the writer
+    std::byte* data{};
+    shared_buffer_pool* owner{};
+    shared_buffer_header* next{};   // free-list link (local or remote)
+};
+
+} // namespace detail
+
+// 8-byte, trivially copyable reference to a pooled buffer. It does not own a
+// reference by itself: the pool's retain/release calls manage the count, so
+// handles can be pushed through rings like plain integers.
+class buffer_handle {
+public:
+    buffer_handle() noexcept = default;
+
+    std::byte* data() const noexcept { return header_->data; }
+    std::uint32_t size() const noexcept { return header_->size; }
+    void set_size(std::uint32_t bytes) const noexcept { header_->size = bytes; }
+
+    explicit operator bool() const noexcept { return header_ != nullptr; }
+    friend bool operator==(buffer_handle a, buffer_handle b) noexcept { return a.header_ == b.header_; }
+
+private:
+    friend class shared_buffer_pool;
+    explicit buffer_handle(detail::shared_buffer_header* h) noexcept : header_(h) {}
+
+    detail::shared_buffer_header* header_{};
+};
+
+// Pool of fixed-size, reference-counted buffers for zero-copy fan-out of large
+// payloads: one producer fills a buffer, pushes its handle into several
+// rings, and the buffer returns to the pool when the last consumer releases
+// it.
+//
+// Design notes:
+//  - Payloads are carved from one huge-page region; control blocks live in
+//    a separate cache-line-per-buffer array.
+//  - allocate() and the local free list belong to the owner thread (the one
+//    that constructed the pool, or the last to call adopt()). A final release
+//    on any other thread pushes the buffer onto a lock-free remote-free
+//    stack; the owner takes the whole stack with one exchange when its local
+//    list runs dry, so there is no ABA and no per-buffer CAS on the owner.
+//  - Refcounts are batched: allocate(refs) sets the fan-out count once
+//    instead of one increment per consumer, retain/release take a count,
+//    and release(span) folds runs of the same handle into one atomic and
+//    returns all buffers it frees with one push.
+//  - The pool must outlive all handles.
+
+class shared_buffer_pool : private hpc::support::noncopyable {
+public:
+    // buffer_size is rounded up to a cache-line multiple. Throws
+    // std::bad_alloc if the region cannot be mapped.
+    shared_buffer_pool(std::size_t buffer_size, std::size_t buffer_count);
+    ~shared_buffer_pool();
+
+    shared_buffer_pool(shared_buffer_pool&&) = delete;
+    shared_buffer_pool& operator=(shared_buffer_pool&&) = delete;
+
+    // Owner thread only. Returns a buffer with `refs` references (>= 1), or
+    // an empty handle if the pool is exhausted.
+    [[nodiscard]] buffer_handle allocate(std::uint32_t refs = 1) noexcept;
+
+    // Owner thread only. Up to n buffers with `refs` references each, taken
+    // off the free list in one splice. Returns the number written to out.
+    std::size_t allocate_bulk(buffer_handle* out, std::size_t n, std::uint32_t refs = 1) noexcept;
+
+    // Any thread holding a reference.
+    static void retain(buffer_handle h, std::uint32_t count = 1) noexcept
+    {
+        h.header_->refs.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    // Any thread. Drops `count` references; the last one returns the buffer
+    // to its owning pool.
+    static void release(buffer_handle h, std::uint32_t count = 1) noexcept
+    {
+        if (h.header_->refs.fetch_sub(count, std::memory_order_acq_rel) == count) {
+            h.header_->owner->recycle(h.header_);
+        }
+    }
+
+    // Release one reference per entry, coalescing adjacent equal handles
+    // (e.g. a consumer that drained several fragments of one buffer).
+    // Buffers freed by the batch are chained and returned to their owner
+    // with one remote-free CAS per run of the same owner.
+    static void release(std::span<const buffer_handle> handles) noexcept;
+
+    // Make the calling thread the owner (e.g. after handing the pool over).
+    void adopt() noexcept { owner_thread_ = std::this_thread::get_id(); }
+
+    std::size_t buffer_size() const noexcept { return buffer_size_; }
+    std::size_t capacity() const noexcept { return buffer_count_; }
+
+    // Owner thread only: buffers currently free, including remote returns.
+    std::size_t available() noexcept;
+
+private:
+    void recycle(detail::shared_buffer_header* h) noexcept { recycle_chain(h, h, 1); }
+    void recycle_chain(detail::shared_buffer_header* first, detail::shared_buffer_header* last,
+                       std::size_t count) noexcept;
+    void reclaim_remote() noexcept;
+
+    std::size_t buffer_size_{};
+    std::size_t buffer_count_{};
+    hpc::support::huge_page_region region_{};
+    detail::shared_buffer_header* headers_{};
+
+    // Owner-thread state.
+    std::thread::id owner_thread_{};
+    detail::shared_buffer_header* local_free_{};
+    std::size_t local_count_{};
+
+    // Buffers released last on other threads.
+    alignas(hpc::support::destructive_interference_size) std::atomic<detail::shared_buffer_header*> remote_free_{nullptr};
+};
+
+} // namespace hpc::core
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpc/core/ring_buffer.hpp>
+
+namespace hpc::core {
+
+// Consumer that merges several spsc_ring_buffers into one stream ordered by a
+// timestamp carried in each element, without copying elements out of the
+// rings.
+//
+// Design notes:
+//  - Each ring's head slot is peeked in place with try_acquire_consumer_slot
+//    and stays in the ring until released, so the merged stream is zero-copy.
+//  - A winner tournament tree over the head timestamps yields the oldest head
+//    in O(1); releasing it re-peeks only that ring and replays one
+//    leaf-to-root path, O(log k). Ties go to the lower ring index, which
+//    makes A/B arbitration deterministic.
+//  - Every input must be ordered by timestamp on its own. While all rings
+//    have a head, the oldest is always safe to release. When some ring is
+//    empty, its next element could still be older; the lateness window
+//    bounds how long to wait for it: the oldest head is released once it is
+//    at least `lateness_window` behind the watermark (the newest timestamp
+//    seen, or the time supplied via advance_watermark()).
+//  - Rings without a head are kept in a list, so a peek re-probes only those
+//    (one load of each producer index) rather than scanning all k rings.
+//  - Elements that arrive older than something already released are still
+//    delivered (they are the oldest head at that point) and counted in
+//    late_count().
+//  - Only the consumer thread of every ring may use this object.
+
+template <class T, class KeyOf>
+class spsc_merge_consumer {
+    static_assert(std::is_invocable_r_v<std::uint64_t, const KeyOf&, const T&>,
+                  "KeyOf must map const T& to a std::uint64_t timestamp");
+
+public:
+    using ring_type = spsc_ring_buffer<T>;
+
+    // Never release while any ring is empty.
+    static constexpr std::uint64_t wait_for_all = std::numeric_limits<std::uint64_t>::max();
+
+    explicit spsc_merge_consumer(std::span<ring_type* const> rings,
+                                 std::uint64_t lateness_window = wait_for_all,
+                                 KeyOf key_of = KeyOf{})
+        : rings_(rings.begin(), rings.end())
+        , key_of_(std::move(key_of))
+        , lateness_window_(lateness_window)
+    {
+        leaf_count_ = 1;
+        while (leaf_count_ < rings_.size()) {
+            leaf_count_ <<= 1;
+        }
+        heads_.assign(leaf_count_, nullptr);
+        keys_.assign(leaf_count_, 0);
+        tree_.assign(2 * leaf_count_, 0);
+        // Never holds more than every ring, so pop() can append without
+        // allocating.
+        empty_.reserve(rings_.size());
+        for (std::size_t i = 0; i < rings_.size(); ++i) {
+            empty_.push_back(i);
+        }
+
+        for (std::size_t i = 0; i < leaf_count_; ++i) {
+            tree_[leaf_count_ + i] = i;
+        }
+        for (std::size_t n = leaf_count_ - 1; n > 0; --n) {
+            tree_[n] = winner(tree_[2 * n], tree_[2 * n + 1]);
+        }
+    }
+
+    spsc_merge_consumer(const spsc_merge_consumer&) = delete;
+    spsc_merge_consumer& operator=(const spsc_merge_consumer&) = delete;
+
+    // Oldest releasable element, or nullptr if none may be released yet. The
+    // element stays owned by its ring until pop(). If ring_index is non-null
+    // it receives the index of the ring holding the element.
+    T* peek(std::size_t* ring_index = nullptr)
+    {
+        if (!empty_.empty()) {
+            refill();
+        }
+        const std::size_t w = tree_[1];
+        T* head = heads_[w];
+        if (!head) {
+            return nullptr;
+        }
+        if (!empty_.empty() && !beyond_window(keys_[w])) {
+            return nullptr;
+        }
+        if (ring_index) {
+            *ring_index = w;
+        }
+        return head;
+    }
+
+    // Destroy and release the element returned by the last successful peek().
+    void pop() noexcept
+    {
+        const std::size_t w = tree_[1];
+        last_released_ = keys_[w];
+        heads_[w]->~T();
+        rings_[w]->release_consumer_slot();
+        heads_[w] = nullptr;
+        if (!set_head(w, rings_[w]->try_acquire_consumer_slot())) {
+            empty_.push_back(w);
+        }
+        replay(w);
+    }
+
+    // Invoke consume(std::size_t ring_index, T&) on up to max_count elements
+    // in merged order. Returns the number consumed.
+    template <class F>
+    std::size_t drain(F&& consume, std::size_t max_count = static_cast<std::size_t>(-1))
+    {
+        std::size_t n = 0;
+        std::size_t ring = 0;
+        while (n < max_count) {
+            T* value = peek(&ring);
+            if (!value) break;
+            consume(ring, *value);
+            pop();
+            ++n;
+        }
+        return n;
+    }
+
+    // Move the watermark forward, e.g. from a clock in the same time base as
+    // the element timestamps, so a quiet feed does not stall the merge.
+    void advance_watermark(std::uint64_t now) noexcept
+    {
+        if (now > watermark_) watermark_ = now;
+    }
+
+    std::size_t ring_count() const noexcept { return rings_.size(); }
+    std::uint64_t lateness_window() const noexcept { return lateness_window_; }
+    std::uint64_t watermark() const noexcept { return watermark_; }
+
+    // Elements delivered with a timestamp older than one already released.
+    std::uint64_t late_count() const noexcept { return late_count_; }
+
+private:
+    // Order (non-empty before empty, older first, lower index first).
+    std::size_t winner(std::size_t a, std::size_t b) const noexcept
+    {
+        if (!heads_[b]) return a;
+        if (!heads_[a]) return b;
+        if (keys_[b] < keys_[a]) return b;
+        if (keys_[a] < keys_[b]) return a;
+        return a < b ? a : b;
+    }
+
+    void replay(std::size_t leaf) noexcept
+    {
+        for (std::size_t n = (leaf_count_ + leaf) >> 1; n > 0; n >>= 1) {
+            tree_[n] = winner(tree_[2 * n], tree_[2 * n + 1]);
+        }
+    }
+
+    // False (and no change) if the ring had nothing to peek.
+    bool set_head(std::size_t i, T* head)
+    {
+        if (!head) return false;
+        heads_[i] = head;
+        keys_[i] = key_of_(*head);
+        if (keys_[i] > watermark_) watermark_ = keys_[i];
+        if (keys_[i] < last_released_) ++late_count_;
+        return true;
+    }
+
+    // Re-peek the rings that had no head; those still empty stay listed.
+    void refill()
+    {
+        std::size_t kept = 0;
+        for (std::size_t k = 0; k < empty_.size(); ++k) {
+            const std::size_t i = empty_[k];
+            if (set_head(i, rings_[i]->try_acquire_consumer_slot())) {
+                replay(i);
+            } else {
+                empty_[kept++] = i;
+            }
+        }
+        empty_.resize(kept);
+    }
+
+    bool beyond_window(std::uint64_t key) const noexcept
+    {
+        return lateness_window_ != wait_for_all && watermark_ >= key
+            && watermark_ - key >= lateness_window_;
+    }
+
+    std::vector<ring_type*> rings_;
+    KeyOf key_of_;
+    std::uint64_t lateness_window_{};
+
+    std::size_t leaf_count_{};        // ring count rounded up to a power of two
+    std::vector<T*> heads_;           // peeked head slot per ring, null if empty
+    std::vector<std::uint64_t> keys_; // timestamp of heads_[i]
+    std::vector<std::size_t> tree_;   // winner tree; tree_[1] is the root
+    std::vector<std::size_t> empty_;  // rings without a peeked head
+
+    std::uint64_t watermark_{};
+    std::uint64_t last_released_{};
+    std::uint64_t late_count_{};
+};
+
+} // namespace hpc::core
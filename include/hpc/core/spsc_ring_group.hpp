@@ -0,0 +1,169 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <hpc/core/ring_buffer.hpp>
+#include <hpc/support/cache_line.hpp>
+
+namespace hpc::core {
+
+// A set of spsc_ring_buffers serviced by one consumer thread, with a shared
+// activity bitmap so the consumer visits only rings that have data instead of
+// probing every ring's indices on each sweep.
+//
+// Design notes:
+//  - One bit per ring, packed into 64-bit words grouped eight to a cache
+//    line; a sweep reads the bitmap lines (2,048 rings fit in four lines),
+//    skips zero words and walks set bits with countr_zero (tzcnt).
+//  - Producers set their bit only on the empty -> non-empty transition:
+//    after publishing, a producer checks whether the consumer has already
+//    caught up with everything pushed before; if not, the ring is still
+//    marked active and the bit is left alone.
+//  - The consumer takes a whole word of bits with one exchange, drains each
+//    ring, then re-checks it and re-arms the bits of rings that still hold
+//    data. Producer and consumer each place a seq_cst fence between their
+//    index store and the opposite index load, so either the producer sees
+//    the drain or the consumer's re-check sees the push; no wakeup is lost.
+//  - Each ring keeps its own producer; push through the group (not through
+//    ring(i) directly) so the bitmap stays in sync.
+
+template <class T>
+class spsc_ring_group {
+public:
+    spsc_ring_group(std::size_t ring_count, std::size_t ring_capacity)
+        : lines_((ring_count + bits_per_line - 1) / bits_per_line)
+    {
+        rings_.reserve(ring_count);
+        for (std::size_t i = 0; i < ring_count; ++i) {
+            rings_.push_back(std::make_unique<spsc_ring_buffer<T>>(ring_capacity));
+        }
+    }
+
+    spsc_ring_group(const spsc_ring_group&) = delete;
+    spsc_ring_group& operator=(const spsc_ring_group&) = delete;
+
+    std::size_t size() const noexcept { return rings_.size(); }
+
+    spsc_ring_buffer<T>& ring(std::size_t i) noexcept { return *rings_[i]; }
+
+    // Producer side for ring i.
+    bool try_push(std::size_t i, const T& value)
+    {
+        if (!rings_[i]->try_push(value)) {
+            return false;
+        }
+        notify(i, 1);
+        return true;
+    }
+
+    bool try_push(std::size_t i, T&& value)
+    {
+        if (!rings_[i]->try_push(std::move(value))) {
+            return false;
+        }
+        notify(i, 1);
+        return true;
+    }
+
+    // One fence and at most one bitmap update for the whole batch.
+    std::size_t try_push_batch(std::size_t i, const T* src, std::size_t count)
+    {
+        const std::size_t pushed = rings_[i]->try_push_batch(src, count);
+        if (pushed != 0) {
+            notify(i, pushed);
+        }
+        return pushed;
+    }
+
+    // Zero-copy producer path: fill ring(i).try_acquire_producer_slot(), then
+    // call this instead of ring(i).commit_producer_slot().
+    void commit_producer_slot(std::size_t i)
+    {
+        rings_[i]->commit_producer_slot();
+        notify(i, 1);
+    }
+
+    // Consumer side. Visits every ring marked active, invoking
+    // consume(std::size_t ring_index, T&) for up to max_per_ring elements of
+    // each in FIFO order. Returns the total number consumed.
+    template <class F>
+    std::size_t poll(F&& consume, std::size_t max_per_ring = static_cast<std::size_t>(-1))
+    {
+        std::size_t consumed = 0;
+        for (std::size_t l = 0; l < lines_.size(); ++l) {
+            for (std::size_t w = 0; w < words_per_line; ++w) {
+                auto& word = lines_[l].words[w];
+                if (word.load(std::memory_order_relaxed) == 0) {
+                    continue;
+                }
+                std::uint64_t bits = word.exchange(0, std::memory_order_acquire);
+                const std::size_t base = (l * words_per_line + w) * bits_per_word;
+                const std::uint64_t taken = bits;
+
+                while (bits != 0) {
+                    const std::size_t i = base + static_cast<std::size_t>(std::countr_zero(bits));
+                    bits &= bits - 1;
+                    consumed += rings_[i]->drain([&](T& value) { consume(i, value); }, max_per_ring);
+                }
+
+                // Order the head stores above before re-reading the tails.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::uint64_t still_active = 0;
+                for (bits = taken; bits != 0; bits &= bits - 1) {
+                    const auto b = static_cast<unsigned>(std::countr_zero(bits));
+                    if (!rings_[base + b]->empty()) {
+                        still_active |= std::uint64_t{1} << b;
+                    }
+                }
+                if (still_active != 0) {
+                    word.fetch_or(still_active, std::memory_order_release);
+                }
+            }
+        }
+        return consumed;
+    }
+
+    // Number of rings currently marked active (a snapshot).
+    std::size_t active_count() const noexcept
+    {
+        std::size_t n = 0;
+        for (const auto& line : lines_) {
+            for (const auto& word : line.words) {
+                n += static_cast<std::size_t>(std::popcount(word.load(std::memory_order_relaxed)));
+            }
+        }
+        return n;
+    }
+
+private:
+    static constexpr std::size_t bits_per_word = 64;
+    static constexpr std::size_t words_per_line = hpc::support::cache_line_size / sizeof(std::uint64_t);
+    static constexpr std::size_t bits_per_line = bits_per_word * words_per_line;
+
+    struct alignas(hpc::support::cache_line_size) bitmap_line {
+        std::atomic<std::uint64_t> words[words_per_line]{};
+    };
+
+    // Called by ring i's producer after publishing `pushed` elements.
+    void notify(std::size_t i, std::size_t pushed) noexcept
+    {
+        // Order the tail store before reading the consumer's head.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (rings_[i]->size() > pushed) {
+            return; // older elements still pending; the bit is (or will be) set
+        }
+        auto& word = lines_[i / bits_per_line].words[(i / bits_per_word) % words_per_line];
+        word.fetch_or(std::uint64_t{1} << (i % bits_per_word), std::memory_order_release);
+    }
+
+    std::vector<std::unique_ptr<spsc_ring_buffer<T>>> rings_;
+    std::vector<bitmap_line> lines_;
+};
+
+} // namespace hpc::core
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <hpc/core/ring_buffer.hpp>
+#include <hpc/support/cache_line.hpp>
+
+namespace hpc::core {
+
+// Unbounded single-producer single-consumer queue built from a linked list of
+// fixed-size, cache-aligned segments.
+//
+// Design notes:
+//  - Each segment is written front to back exactly once. The producer
+//    publishes progress through the segment's `published` count (release);
+//    the consumer reads it with acquire semantics and caches it locally, so
+//    the per-element fast path is one local compare, the construct/move, and
+//    one release store, as in spsc_ring_buffer.
+//  - When a segment is full the producer links a fresh one via `next`. The
+//    consumer follows `next` once it has drained a segment and hands the old
+//    segment back to the producer through a small spsc_ring_buffer, which
+//    acts as the segment pool; new segments are allocated only when the pool
+//    is empty, and dropped when it is full.
+//  - Producer and consumer state are padded apart (destructive_interference_size).
+//  - Unlike the bounded ring, remaining elements are destroyed on teardown,
+//    since the segments are released anyway.
+
+template <class T>
+class spsc_unbounded_queue {
+    static_assert(std::is_nothrow_destructible_v<T>,
+                  "T must be nothrow destructible for lock-free teardown");
+
+public:
+    // segment_capacity: elements per segment. pool_capacity: drained
+    // segments kept for reuse. preallocated_segments: segments placed in the
+    // pool up front so the producer does not allocate during warm-up.
+    explicit spsc_unbounded_queue(std::size_t segment_capacity = 1024,
+                                  std::size_t pool_capacity = 16,
+                                  std::size_t preallocated_segments = 0)
+        : segment_capacity_(segment_capacity ? segment_capacity : 1)
+        , pool_(pool_capacity ? pool_capacity : 1)
+    {
+        segment* first = allocate_segment();
+        producer_.current = first;
+        consumer_.current = first;
+        producer_.allocated = 1;
+
+        for (std::size_t i = 0; i < preallocated_segments; ++i) {
+            segment* s = allocate_segment();
+            if (!pool_.try_push(s)) {
+                free_segment(s);
+                break;
+            }
+            ++producer_.allocated;
+        }
+    }
+
+    ~spsc_unbounded_queue()
+    {
+        segment* s = consumer_.current;
+        std::size_t begin = consumer_.index;
+        while (s) {
+            const std::size_t end = s->published.load(std::memory_order_relaxed);
+            for (std::size_t i = begin; i < end; ++i) {
+                slot_at(s, i)->~T();
+            }
+            segment* next = s->next.load(std::memory_order_relaxed);
+            free_segment(s);
+            s = next;
+            begin = 0;
+        }
+
+        segment* pooled = nullptr;
+        while (pool_.try_pop(pooled)) {
+            free_segment(pooled);
+        }
+    }
+
+    spsc_unbounded_queue(const spsc_unbounded_queue&) = delete;
+    spsc_unbounded_queue& operator=(const spsc_unbounded_queue&) = delete;
+
+    // Producer side. Never fails for lack of space; throws std::bad_alloc
+    // only if a new segment is needed and cannot be allocated.
+    template <class... Args>
+    void emplace(Args&&... args)
+    {
+        if (producer_.index == segment_capacity_) {
+            link_next_segment();
+        }
+        segment* s = producer_.current;
+        ::new (static_cast<void*>(slot_at(s, producer_.index))) T(std::forward<Args>(args)...);
+        ++producer_.index;
+        s->published.store(producer_.index, std::memory_order_release);
+    }
+
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    // Consumer side.
+    bool try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        if (!refresh()) {
+            return false;
+        }
+        T* slot = slot_at(consumer_.current, consumer_.index);
+        out = std::move(*slot);
+        slot->~T();
+        ++consumer_.index;
+        return true;
+    }
+
+    // Consume up to max_count elements in place, invoking consume(T&) on
+    // each before destroying it. Each segment's published count is loaded
+    // once per run rather than once per element. Returns the number consumed.
+    template <class F>
+    std::size_t drain(F&& consume, std::size_t max_count = static_cast<std::size_t>(-1))
+    {
+        std::size_t n = 0;
+        while (n < max_count && refresh()) {
+            const std::size_t available = consumer_.published - consumer_.index;
+            const std::size_t run = available < max_count - n ? available : max_count - n;
+            segment* s = consumer_.current;
+            for (std::size_t i = 0; i < run; ++i) {
+                T* slot = slot_at(s, consumer_.index + i);
+                consume(*slot);
+                slot->~T();
+            }
+            consumer_.index += run;
+            n += run;
+        }
+        return n;
+    }
+
+    // Consumer-side emptiness check.
+    bool empty() noexcept { return !refresh(); }
+
+    std::size_t segment_capacity() const noexcept { return segment_capacity_; }
+
+    // Segments allocated so far (producer-side statistic).
+    std::size_t segments_allocated() const noexcept { return producer_.allocated; }
+
+private:
+    struct alignas(hpc::support::cache_line_size) segment {
+        // Both written only by the producer; share one line.
+        std::atomic<segment*> next{nullptr};
+        std::atomic<std::size_t> published{0};
+    };
+
+    struct alignas(hpc::support::destructive_interference_size) producer_state {
+        segment* current{};
+        std::size_t index{};     // next slot to write in `current`
+        std::size_t allocated{}; // segments allocated so far
+    };
+
+    struct alignas(hpc::support::destructive_interference_size) consumer_state {
+        segment* current{};
+        std::size_t index{};     // next slot to read in `current`
+        std::size_t published{}; // cached copy of current->published
+    };
+
+    static constexpr std::size_t segment_alignment =
+        alignof(T) > alignof(segment) ? alignof(T) : alignof(segment);
+    static constexpr std::size_t slots_offset =
+        (sizeof(segment) + alignof(T) - 1) & ~(alignof(T) - 1);
+
+    T* slot_at(segment* s, std::size_t i) const noexcept
+    {
+        return reinterpret_cast<T*>(reinterpret_cast<std::byte*>(s) + slots_offset + i * sizeof(T));
+    }
+
+    segment* allocate_segment()
+    {
+        void* raw = ::operator new(slots_offset + segment_capacity_ * sizeof(T),
+                                   std::align_val_t{segment_alignment});
+        return ::new (raw) segment{};
+    }
+
+    static void free_segment(segment* s) noexcept
+    {
+        s->~segment();
+        ::operator delete(static_cast<void*>(s), std::align_val_t{segment_alignment});
+    }
+
+    void link_next_segment()
+    {
+        segment* s = nullptr;
+        if (pool_.try_pop(s)) {
+            // The consumer is done with a pooled segment; reset it before the
+            // release store of `next` makes it visible again.
+            s->next.store(nullptr, std::memory_order_relaxed);
+            s->published.store(0, std::memory_order_relaxed);
+        } else {
+            s = allocate_segment();
+            ++producer_.allocated;
+        }
+        producer_.current->next.store(s, std::memory_order_release);
+        producer_.current = s;
+        producer_.index = 0;
+    }
+
+    // Make sure consumer_.index < consumer_.published, moving to the next
+    // segment if the current one is fully drained. Returns false if empty.
+    bool refresh() noexcept
+    {
+        if (consumer_.index < consumer_.published) {
+            return true;
+        }
+        consumer_.published = consumer_.current->published.load(std::memory_order_acquire);
+        if (consumer_.index < consumer_.published) {
+            return true;
+        }
+        if (consumer_.index < segment_capacity_) {
+            return false;
+        }
+
+        // Segment exhausted. A non-null next implies the producer published
+        // every slot of this segment before linking it.
+        segment* next = consumer_.current->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        segment* drained = std::exchange(consumer_.current, next);
+        if (!pool_.try_push(drained)) {
+            free_segment(drained);
+        }
+        consumer_.index = 0;
+        consumer_.published = next->published.load(std::memory_order_acquire);
+        return consumer_.published != 0;
+    }
+
+    std::size_t segment_capacity_{};
+    spsc_ring_buffer<segment*> pool_; // drained segments, consumer -> producer
+
+    producer_state producer_{};
+    consumer_state consumer_{};
+};
+
+} // namespace hpc::core
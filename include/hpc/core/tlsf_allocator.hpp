@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <hpc/support/huge_pages.hpp>
+#include <hpc/support/noncopyable.hpp>
+
+namespace hpc::core {
+
+// Two-Level Segregated Fit allocator: variable-size malloc/free with an O(1)
+// worst case, for real-time threads that cannot use the system heap.
+//
+// Design notes:
+//  - Free blocks are kept in 32 size-class lists per power of two (first
+//    level = log2 of the size, second level = the next 5 bits). A first-level
+//    bitmap and one second-level bitmap per first level record which lists
+//    are non-empty, so finding a fitting list is two countr_zero calls.
+//  - allocate() rounds the request up to the next size class, so any block
+//    in the chosen list fits without walking it (good-fit, not best-fit).
+//    The remainder of a larger block is split off and re-listed.
+//  - deallocate() coalesces immediately with free physical neighbours,
+//    found through a 16-byte in-band header (previous-block pointer and size
+//    with free / previous-free flags).
+//  - No step loops over blocks or lists, so both calls are O(1) in the
+//    number of blocks; cost depends only on the fixed bitmap widths.
+//  - Payloads are 16-byte aligned. Memory is a huge-page region or a
+//    caller-supplied buffer.
+//  - Not thread-safe; one owner per instance.
+
+class tlsf_allocator : private hpc::support::noncopyable {
+public:
+    // Maps `capacity` bytes of huge-page-backed memory. Throws std::bad_alloc
+    // if the region cannot be mapped.
+    explicit tlsf_allocator(std::size_t capacity);
+
+    // Manage a caller-owned buffer. Throws std::invalid_argument if it is too
+    // small to hold a block.
+    tlsf_allocator(void* buffer, std::size_t bytes);
+
+    ~tlsf_allocator();
+
+    tlsf_allocator(tlsf_allocator&&) = delete;
+    tlsf_allocator& operator=(tlsf_allocator&&) = delete;
+
+    // nullptr if no free block is large enough (or bytes == 0).
+    [[nodiscard]] void* allocate(std::size_t bytes) noexcept;
+
+    // p must come from allocate(); nullptr is ignored.
+    void deallocate(void* p) noexcept;
+
+    // Usable size of the block backing p (>= the requested size).
+    std::size_t block_size(const void* p) const noexcept;
+
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    // Sum of free payload bytes (headers excluded).
+    std::size_t free_bytes() const noexcept { return free_bytes_; }
+
+    // Payload of the largest free block. Walks one free list; diagnostics
+    // only.
+    std::size_t largest_free_block() const noexcept;
+
+    static constexpr std::size_t alignment = 16;
+
+private:
+    struct block;
+
+    static constexpr unsigned sl_log2 = 5;
+    static constexpr unsigned sl_count = 1u << sl_log2;
+    static constexpr unsigned align_log2 = 4;
+    static constexpr unsigned fl_shift = sl_log2 + align_log2;
+    static constexpr std::size_t small_block = std::size_t{1} << fl_shift;
+    static constexpr unsigned fl_max_log2 = 40; // largest block: 1 TiB
+    static constexpr unsigned fl_count = fl_max_log2 - fl_shift + 1;
+
+    void init(void* buffer, std::size_t bytes);
+
+    static void mapping(std::size_t size, unsigned& fl, unsigned& sl) noexcept;
+    block* find_suitable(unsigned& fl, unsigned& sl) const noexcept;
+    void insert(block* b) noexcept;
+    void remove(block* b) noexcept;
+
+    hpc::support::huge_page_region region_{};
+    std::size_t capacity_{};
+    std::size_t free_bytes_{};
+
+    std::uint64_t fl_bitmap_{};
+    std::uint32_t sl_bitmap_[fl_count]{};
+    block* free_lists_[fl_count][sl_count]{};
+};
+
+} // namespace hpc::core
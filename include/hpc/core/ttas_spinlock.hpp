@@ -1,14 +1,12 @@
 #pragma once
 
 #include <atomic>
-#include <thread>
-#ifdef __x86_64__
-#include <immintrin.h>
-#endif
+
+#include <hpc/core/backoff.hpp>
 
 namespace hpc::core {
 
-// Test-Test-And-Set spinlock with simple exponential backoff.
+// Test-Test-And-Set spinlock with randomized exponential backoff.
 //
 // Design notes:
 //  - First performs a relaxed load to avoid unnecessary cache line invalidation
@@ -16,18 +14,20 @@ namespace hpc::core {
 //  - Only when the lock appears free does it attempt an exchange with
 //    acquire semantics.
 //  - Release semantics on unlock publish all prior writes to other threads.
+//  - Waiters back off for a random, growing time in nanoseconds
+//    (randomized_backoff), so those released by one unlock do not all retry
+//    the exchange at once.
 class ttas_spinlock {
 public:
     ttas_spinlock() noexcept = default;
 
     void lock() noexcept
     {
-        std::size_t backoff = 1;
+        randomized_backoff backoff;
         for (;;) {
             // Test phase: spin while lock appears held using relaxed loads.
             while (flag_.load(std::memory_order_relaxed)) {
-                pause(backoff);
-                backoff = std::min<std::size_t>(backoff * 2, max_backoff_);
+                backoff.pause();
             }
 
             // Test-and-set phase: attempt to acquire.
@@ -50,19 +50,6 @@ public:
     }
 
 private:
-    static constexpr std::size_t max_backoff_ = 1u << 16;
-
-    static void pause(std::size_t iterations) noexcept
-    {
-        for (std::size_t i = 0; i < iterations; ++i) {
-        #ifdef __x86_64__
-            _mm_pause();
-        #else
-            std::this_thread::yield();
-        #endif
-        }
-    }
-
     std::atomic<bool> flag_{false};
 };
 
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <hpc/support/huge_pages.hpp>
+#include <hpc/support/noncopyable.hpp>
+
+namespace hpc::io {
+
+// Append-only file writer that keeps the calling thread off blocking write(2).
+//
+// Design notes:
+//  - append() copies into one of a fixed set of staging buffers carved from a
+//    single huge-page region. A full buffer is handed to the I/O engine and
+//    the caller moves on to the next free one; it only waits when every
+//    buffer is in flight.
+//  - With io_uring (raw syscalls, no liburing), the buffers are registered
+//    once and written with WRITE_FIXED, so the kernel skips per-I/O page
+//    pinning. SQEs are queued in user space and submitted in batches of
+//    `submit_batch`; completions are reaped from the mapped CQ ring without a
+//    system call unless the writer has to wait.
+//  - sync() links a data fsync behind the last write (IOSQE_IO_LINK) and
+//    drains earlier writes ahead of it (IOSQE_IO_DRAIN), so when it returns
+//    everything appended so far is durable.
+//  - Where io_uring is unavailable (old kernel, seccomp, or
+//    `force_fallback`), a worker thread performs the same requests with
+//    pwritev, coalescing adjacent buffers into one call.
+//  - I/O errors are sticky: the first failure is reported as
+//    std::runtime_error from the next append/flush/sync.
+//  - Single-threaded: one recorder thread owns the writer.
+
+struct async_file_writer_config {
+    std::string path;
+    std::size_t buffer_size = std::size_t{1} << 20; // bytes per staging buffer (rounded to 4 KiB)
+    std::size_t buffer_count = 8;                   // staging buffers, i.e. max writes in flight
+    std::size_t submit_batch = 4;                   // queued writes per io_uring_enter
+    bool truncate = true;                           // start from an empty file
+    bool force_fallback = false;                    // skip io_uring, use the pwritev thread
+};
+
+class async_file_writer : private hpc::support::noncopyable {
+public:
+    // Opens (creating if needed) the file and sets up the engine. Throws
+    // std::runtime_error on failure.
+    explicit async_file_writer(const async_file_writer_config& cfg);
+
+    // Flushes and waits for outstanding writes; errors are swallowed.
+    ~async_file_writer();
+
+    async_file_writer(async_file_writer&&) = delete;
+    async_file_writer& operator=(async_file_writer&&) = delete;
+
+    void append(std::span<const std::byte> data);
+
+    // Hand the partially filled buffer to the engine and submit everything
+    // queued. Does not wait for completion.
+    void flush();
+
+    // flush(), then make all appended data durable (fdatasync) and wait.
+    void sync();
+
+    // Wait for every submitted write to complete.
+    void wait();
+
+    bool uses_io_uring() const noexcept;
+
+    // Bytes accepted by append() so far (the logical file size).
+    std::uint64_t size() const noexcept { return appended_; }
+
+    // Bytes whose write has completed.
+    std::uint64_t bytes_written() const noexcept { return completed_; }
+
+    // Write requests issued to the engine so far.
+    std::uint64_t writes_issued() const noexcept { return writes_issued_; }
+
+    class engine;
+
+    struct write_request {
+        std::uint32_t buffer;   // staging buffer index, or no_buffer for a bare fsync
+        std::uint32_t length;   // bytes to write
+        std::uint64_t offset;   // file offset
+        bool fsync;             // follow with fdatasync once this and all earlier writes land
+    };
+
+    struct completion {
+        std::uint32_t buffer;   // as in write_request
+        std::uint32_t length;
+        int error;              // 0 or errno
+    };
+
+    static constexpr std::uint32_t no_buffer = ~std::uint32_t{0};
+
+private:
+    void dispatch(bool fsync);
+    void reap(bool wait);
+    void throw_if_failed() const;
+    std::byte* buffer_at(std::uint32_t index) const noexcept;
+
+    int fd_{-1};
+    std::size_t buffer_size_{};
+    hpc::support::huge_page_region region_{};
+    std::unique_ptr<engine> engine_;
+
+    std::vector<std::uint32_t> free_buffers_;
+    std::vector<completion> completions_;
+    std::uint32_t current_{no_buffer}; // buffer being filled
+    std::size_t fill_{};               // bytes in the current buffer
+    std::uint64_t current_offset_{};   // file offset of the current buffer
+
+    std::size_t in_flight_{};          // requests not yet completed
+    std::uint64_t appended_{};
+    std::uint64_t completed_{};
+    std::uint64_t writes_issued_{};
+    int error_{};
+};
+
+} // namespace hpc::io
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if defined(HPC_HAS_UDP_BATCH) && !HPC_HAS_UDP_BATCH
+#error "hpc::io UDP batching requires Linux recvmmsg/sendmmsg"
+#endif
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <hpc/core/ring_buffer.hpp>
+#include <hpc/support/cache_line.hpp>
+
+namespace hpc::io {
+
+// Batched UDP stages between sockets and spsc_ring_buffers.
+//
+// Design notes:
+//  - udp_receiver acquires a run of free ring slots with the batch producer
+//    slot API and points one recvmmsg iovec at each slot's payload, so up to
+//    `batch` datagrams land directly in the ring with one system call and
+//    are published with one index store.
+//  - udp_sender does the reverse: it points sendmmsg at a run of readable
+//    slots and releases only as many as the kernel accepted.
+//  - Both are non-blocking (MSG_DONTWAIT) and meant to be driven by a
+//    polling loop or an epoll readiness callback. Setup failures throw;
+//    the hot path reports errors through last_error() instead.
+
+inline constexpr std::size_t udp_max_batch = 64;
+
+// Ring slot holding one datagram. The payload starts on its own cache line.
+template <std::size_t MaxPayload = 2048>
+struct udp_datagram {
+    std::uint32_t length;   // payload bytes (clipped to MaxPayload if truncated)
+    std::uint32_t flags;    // msg_flags from the kernel, e.g. MSG_TRUNC
+    socklen_t peer_length;  // 0 to send on a connected socket
+    sockaddr_in6 peer;      // source on receive, destination on send (v4 or v6)
+    alignas(hpc::support::cache_line_size) std::byte payload[MaxPayload];
+
+    static constexpr std::size_t max_payload = MaxPayload;
+};
+
+// Open a non-blocking UDP socket bound to ip:port (port 0 picks one). With
+// rcvbuf_bytes != 0 the receive buffer is enlarged. Throws std::runtime_error.
+int open_udp_socket(const char* ip, std::uint16_t port, int rcvbuf_bytes = 0);
+
+// Connect a UDP socket to ip:port so datagrams can be sent without a peer.
+void connect_udp_socket(int fd, const char* ip, std::uint16_t port);
+
+// Locally bound port of a socket.
+std::uint16_t local_port(int fd);
+
+template <class Datagram>
+class udp_receiver {
+public:
+    udp_receiver(int fd, hpc::core::spsc_ring_buffer<Datagram>& ring, std::size_t batch = udp_max_batch) noexcept
+        : fd_(fd)
+        , ring_(&ring)
+        , batch_(batch == 0 || batch > udp_max_batch ? udp_max_batch : batch)
+    {
+    }
+
+    // One recvmmsg into free ring slots. Returns datagrams received (0 if
+    // none were pending or the ring is full).
+    std::size_t poll() noexcept
+    {
+        const std::size_t n = ring_->try_acquire_producer_slots(std::span<Datagram*>(slots_.data(), batch_));
+        if (n == 0) {
+            return 0;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            Datagram* d = slots_[i];
+            iov_[i] = {d->payload, Datagram::max_payload};
+            msgs_[i] = {};
+            msgs_[i].msg_hdr.msg_name = &d->peer;
+            msgs_[i].msg_hdr.msg_namelen = sizeof(d->peer);
+            msgs_[i].msg_hdr.msg_iov = &iov_[i];
+            msgs_[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int got = ::recvmmsg(fd_, msgs_.data(), static_cast<unsigned>(n), MSG_DONTWAIT, nullptr);
+        if (got <= 0) {
+            if (got < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                last_error_ = errno;
+            }
+            return 0;
+        }
+
+        const auto received = static_cast<std::size_t>(got);
+        for (std::size_t i = 0; i < received; ++i) {
+            Datagram* d = slots_[i];
+            d->length = msgs_[i].msg_len;
+            d->flags = static_cast<std::uint32_t>(msgs_[i].msg_hdr.msg_flags);
+            d->peer_length = msgs_[i].msg_hdr.msg_namelen;
+            if (d->flags & MSG_TRUNC) {
+                ++truncated_;
+            }
+        }
+        ring_->commit_producer_slots(received);
+        ++syscalls_;
+        return received;
+    }
+
+    int last_error() const noexcept { return last_error_; }
+    std::uint64_t truncated() const noexcept { return truncated_; }
+    std::uint64_t syscalls() const noexcept { return syscalls_; }
+
+private:
+    int fd_;
+    hpc::core::spsc_ring_buffer<Datagram>* ring_;
+    std::size_t batch_;
+    int last_error_{};
+    std::uint64_t truncated_{};
+    std::uint64_t syscalls_{};
+
+    std::array<Datagram*, udp_max_batch> slots_{};
+    std::array<iovec, udp_max_batch> iov_{};
+    std::array<mmsghdr, udp_max_batch> msgs_{};
+};
+
+template <class Datagram>
+class udp_sender {
+public:
+    udp_sender(int fd, hpc::core::spsc_ring_buffer<Datagram>& ring, std::size_t batch = udp_max_batch) noexcept
+        : fd_(fd)
+        , ring_(&ring)
+        , batch_(batch == 0 || batch > udp_max_batch ? udp_max_batch : batch)
+    {
+    }
+
+    // One sendmmsg over readable ring slots. Returns datagrams sent; slots
+    // the kernel did not accept (e.g. a full socket buffer) stay queued.
+    std::size_t flush() noexcept
+    {
+        const std::size_t n = ring_->try_acquire_consumer_slots(std::span<Datagram*>(slots_.data(), batch_));
+        if (n == 0) {
+            return 0;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            Datagram* d = slots_[i];
+            iov_[i] = {d->payload, d->length};
+            msgs_[i] = {};
+            if (d->peer_length != 0) {
+                msgs_[i].msg_hdr.msg_name = &d->peer;
+                msgs_[i].msg_hdr.msg_namelen = d->peer_length;
+            }
+            msgs_[i].msg_hdr.msg_iov = &iov_[i];
+            msgs_[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int sent = ::sendmmsg(fd_, msgs_.data(), static_cast<unsigned>(n), MSG_DONTWAIT);
+        if (sent <= 0) {
+            if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                last_error_ = errno;
+            }
+            return 0;
+        }
+        ring_->release_consumer_slots(static_cast<std::size_t>(sent));
+        ++syscalls_;
+        return static_cast<std::size_t>(sent);
+    }
+
+    int last_error() const noexcept { return last_error_; }
+    std::uint64_t syscalls() const noexcept { return syscalls_; }
+
+private:
+    int fd_;
+    hpc::core::spsc_ring_buffer<Datagram>* ring_;
+    std::size_t batch_;
+    int last_error_{};
+    std::uint64_t syscalls_{};
+
+    std::array<Datagram*, udp_max_batch> slots_{};
+    std::array<iovec, udp_max_batch> iov_{};
+    std::array<mmsghdr, udp_max_batch> msgs_{};
+};
+
+} // namespace hpc::io
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(HPC_HAS_EVENTFD) && !HPC_HAS_EVENTFD
+#error "hpc::ipc::event_fd (and notifying_ring) require Linux eventfd/epoll"
+#endif
+
+#include <sys/epoll.h>
+
+#include <hpc/support/noncopyable.hpp>
+
+namespace hpc::ipc {
+
+// Non-blocking Linux eventfd, used to wake a reactor thread blocked in
+// epoll_wait. signal() adds to the counter; consume() reads and resets it.
+// The descriptor is readable (EPOLLIN) while the counter is non-zero.
+// Linux only: hpc_core defines HPC_HAS_EVENTFD=1 where it is built.
+
+class event_fd : private hpc::support::noncopyable {
+public:
+    event_fd();
+    ~event_fd();
+
+    event_fd(event_fd&&) = delete;
+    event_fd& operator=(event_fd&&) = delete;
+
+    int fd() const noexcept { return fd_; }
+
+    // One write(2). Safe from any thread.
+    void signal() noexcept;
+
+    // One read(2); returns the accumulated count, 0 if there was none.
+    std::uint64_t consume() noexcept;
+
+private:
+    int fd_{-1};
+};
+
+// Thin epoll helpers; both throw std::runtime_error on failure.
+
+// Create an epoll instance (close-on-exec).
+int create_epoll();
+
+// Register fd for `events` (level-triggered unless EPOLLET is given) with
+// `user_data` handed back in epoll_event::data.u64.
+void epoll_add(int epoll_fd, int fd, std::uint64_t user_data, std::uint32_t events = EPOLLIN);
+
+inline void epoll_add(int epoll_fd, const event_fd& ev, std::uint64_t user_data)
+{
+    epoll_add(epoll_fd, ev.fd(), user_data);
+}
+
+} // namespace hpc::ipc
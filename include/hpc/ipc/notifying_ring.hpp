@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include <hpc/core/ring_buffer.hpp>
+#include <hpc/ipc/event_fd.hpp>
+#include <hpc/support/cache_line.hpp>
+
+namespace hpc::ipc {
+
+// spsc_ring_buffer paired with an eventfd, for consumers that sleep in an
+// epoll loop instead of busy-polling.
+//
+// Design notes:
+//  - The consumer arms the ring before it goes back to epoll_wait; the
+//    producer writes the eventfd only when its push lands in an armed ring,
+//    i.e. on the empty -> non-empty transition the consumer is waiting for.
+//    While the consumer is awake, pushes cost no system call.
+//  - Arming is race-free: the consumer sets the flag, fences, and re-checks
+//    the ring; the producer publishes, fences, and checks the flag. One of
+//    them always sees the other, and whichever takes the flag (exchange)
+//    is the only one to act on it.
+//  - service() drains in batches of a caller-chosen budget. When the budget
+//    runs out with data left, it signals the eventfd itself, so a
+//    level-triggered reactor comes back after servicing other descriptors.
+
+template <class T>
+class notifying_spsc_ring {
+public:
+    explicit notifying_spsc_ring(std::size_t capacity) : ring_(capacity) {}
+
+    notifying_spsc_ring(const notifying_spsc_ring&) = delete;
+    notifying_spsc_ring& operator=(const notifying_spsc_ring&) = delete;
+
+    // Descriptor to register with epoll (EPOLLIN).
+    int fd() const noexcept { return event_.fd(); }
+
+    hpc::core::spsc_ring_buffer<T>& ring() noexcept { return ring_; }
+
+    // Producer side.
+    bool try_push(const T& value)
+    {
+        if (!ring_.try_push(value)) {
+            return false;
+        }
+        notify();
+        return true;
+    }
+
+    bool try_push(T&& value)
+    {
+        if (!ring_.try_push(std::move(value))) {
+            return false;
+        }
+        notify();
+        return true;
+    }
+
+    // At most one wakeup for the whole batch.
+    std::size_t try_push_batch(const T* src, std::size_t count)
+    {
+        const std::size_t pushed = ring_.try_push_batch(src, count);
+        if (pushed != 0) {
+            notify();
+        }
+        return pushed;
+    }
+
+    // Zero-copy producer path: fill ring().try_acquire_producer_slot(), then
+    // call this instead of ring().commit_producer_slot().
+    void commit_producer_slot()
+    {
+        ring_.commit_producer_slot();
+        notify();
+    }
+
+    // Consumer side: call when epoll reports fd() readable. Clears the
+    // eventfd, consumes up to `budget` elements with consume(T&), and either
+    // re-arms (ring empty) or re-signals itself (budget exhausted). Returns
+    // the number consumed.
+    template <class F>
+    std::size_t service(F&& consume, std::size_t budget = static_cast<std::size_t>(-1))
+    {
+        event_.consume();
+        std::size_t n = 0;
+        for (;;) {
+            n += ring_.drain(consume, budget - n);
+            if (n == budget) {
+                event_.signal();
+                return n;
+            }
+            if (arm()) {
+                return n;
+            }
+        }
+    }
+
+    // Consumer side: mark the consumer as about to sleep. Returns false if
+    // the ring is not empty, in which case the caller should drain instead
+    // of waiting. service() calls this; use it directly only with a custom
+    // drain loop.
+    bool arm() noexcept
+    {
+        armed_.value.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ring_.empty()) {
+            return true;
+        }
+        // Data raced in; take the flag back. If the producer already took it,
+        // its signal only causes one spurious wakeup.
+        armed_.value.exchange(false, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Number of eventfd writes issued by the producer (for diagnostics).
+    std::size_t wakeups() const noexcept { return wakeups_.value.load(std::memory_order_relaxed); }
+
+private:
+    struct alignas(hpc::support::destructive_interference_size) padded_flag {
+        std::atomic<bool> value{true}; // consumer starts out waiting
+    };
+
+    struct alignas(hpc::support::destructive_interference_size) padded_counter {
+        std::atomic<std::size_t> value{0};
+    };
+
+    void notify() noexcept
+    {
+        // Order the tail store before reading the consumer's flag.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (armed_.value.load(std::memory_order_relaxed)
+            && armed_.value.exchange(false, std::memory_order_relaxed)) {
+            wakeups_.value.store(wakeups_.value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            event_.signal();
+        }
+    }
+
+    hpc::core::spsc_ring_buffer<T> ring_;
+    event_fd event_;
+    padded_flag armed_{};      // written by both sides, rarely
+    padded_counter wakeups_{}; // producer-owned
+};
+
+} // namespace hpc::ipc
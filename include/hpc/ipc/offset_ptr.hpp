@@ -0,0 +1,118 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace hpc::ipc {
+
+// Self-relative pointer for data structures placed in shared or mapped memory
+// that is mapped at a different address in each process.
+//
+// Design notes:
+//  - Stores the distance from its own address to the target, so it stays
+//    valid wherever the containing region is mapped, as long as pointer and
+//    target live in the same region.
+//  - Dereferencing is a single add of the stored offset to `this`; only
+//    get()/bool conversions pay for the null check.
+//  - Null is encoded as offset 1 (an offset_ptr can never usefully point one
+//    byte past its own start), so zero-filled memory is NOT a null offset_ptr;
+//    construct objects in place before use.
+//  - Copying recomputes the offset for the new location, so offset_ptr is not
+//    trivially copyable; containers must copy it by construction or
+//    assignment, never by memcpy.
+
+template <class T>
+class offset_ptr {
+public:
+    using element_type = T;
+    using pointer = T*;
+    using difference_type = std::ptrdiff_t;
+
+    offset_ptr() noexcept = default;
+    offset_ptr(std::nullptr_t) noexcept {}
+    offset_ptr(T* p) noexcept { set(p); }
+    offset_ptr(const offset_ptr& other) noexcept { set(other.get()); }
+
+    template <class U>
+        requires std::is_convertible_v<U*, T*>
+    offset_ptr(const offset_ptr<U>& other) noexcept { set(other.get()); }
+
+    offset_ptr& operator=(const offset_ptr& other) noexcept
+    {
+        set(other.get());
+        return *this;
+    }
+
+    offset_ptr& operator=(T* p) noexcept
+    {
+        set(p);
+        return *this;
+    }
+
+    offset_ptr& operator=(std::nullptr_t) noexcept
+    {
+        offset_ = null_offset;
+        return *this;
+    }
+
+    T* get() const noexcept { return offset_ == null_offset ? nullptr : raw(); }
+
+    std::add_lvalue_reference_t<T> operator*() const noexcept
+        requires(!std::is_void_v<T>)
+    {
+        return *raw();
+    }
+
+    T* operator->() const noexcept { return raw(); }
+
+    template <class U = T>
+        requires(!std::is_void_v<U>)
+    U& operator[](std::ptrdiff_t i) const noexcept { return raw()[i]; }
+
+    explicit operator bool() const noexcept { return offset_ != null_offset; }
+
+    offset_ptr& operator+=(std::ptrdiff_t n) noexcept
+        requires(!std::is_void_v<T>)
+    {
+        offset_ += n * static_cast<std::ptrdiff_t>(sizeof(T));
+        return *this;
+    }
+
+    offset_ptr& operator-=(std::ptrdiff_t n) noexcept
+        requires(!std::is_void_v<T>)
+    {
+        return *this += -n;
+    }
+
+    offset_ptr& operator++() noexcept { return *this += 1; }
+    offset_ptr& operator--() noexcept { return *this -= 1; }
+
+    friend bool operator==(const offset_ptr& a, const offset_ptr& b) noexcept { return a.get() == b.get(); }
+    friend bool operator==(const offset_ptr& a, std::nullptr_t) noexcept { return !a; }
+    friend std::strong_ordering operator<=>(const offset_ptr& a, const offset_ptr& b) noexcept
+    {
+        return std::compare_three_way{}(a.get(), b.get());
+    }
+
+private:
+    static constexpr std::ptrdiff_t null_offset = 1;
+
+    T* raw() const noexcept
+    {
+        return reinterpret_cast<T*>(reinterpret_cast<std::uintptr_t>(this)
+                                    + static_cast<std::uintptr_t>(offset_));
+    }
+
+    void set(T* p) noexcept
+    {
+        offset_ = p ? static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(p)
+                                                  - reinterpret_cast<std::uintptr_t>(this))
+                    : null_offset;
+    }
+
+    std::ptrdiff_t offset_{null_offset};
+};
+
+} // namespace hpc::ipc
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <hpc/ipc/offset_ptr.hpp>
+#include <hpc/ipc/shm_heap.hpp>
+
+namespace hpc::ipc {
+
+// Open-addressing hash map placed in a shared-memory region and allocating
+// its bucket array from an shm_heap in the same region, so other processes
+// can look up entries in place without deserializing.
+//
+// Design notes:
+//  - Linear probing over a power-of-two bucket array with backward-shift
+//    deletion (no tombstones), grown at 70% load.
+//  - The user hash is post-mixed (Fibonacci hashing) so identity hashes of
+//    integer keys still spread across buckets.
+//  - Hash must produce the same value for a key in every process; std::hash
+//    does within one binary, otherwise supply a deterministic hash.
+//  - Not synchronized: one writer at a time, and readers must be excluded
+//    while the map is written (e.g. by a seqlock or an external lock).
+
+template <class K, class V, class Hash = std::hash<K>>
+class shm_hash_map {
+    static_assert(std::is_nothrow_move_constructible_v<K> && std::is_nothrow_move_constructible_v<V>,
+                  "keys and values must be nothrow move constructible for rehashing");
+
+public:
+    explicit shm_hash_map(shm_heap& heap) noexcept : heap_(&heap) {}
+
+    ~shm_hash_map()
+    {
+        clear();
+        if (buckets_) {
+            heap_->deallocate(buckets_.get(), bucket_count_ * sizeof(bucket), alignof(bucket));
+        }
+    }
+
+    shm_hash_map(const shm_hash_map&) = delete;
+    shm_hash_map& operator=(const shm_hash_map&) = delete;
+
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    std::size_t bucket_count() const noexcept { return bucket_count_; }
+
+    // Returns false if the heap cannot satisfy a required rehash.
+    bool insert_or_assign(const K& key, const V& value)
+    {
+        if (V* existing = find(key)) {
+            *existing = value;
+            return true;
+        }
+        if ((size_ + 1) * 10 > bucket_count_ * 7 && !rehash(bucket_count_ ? bucket_count_ * 2 : 16)) {
+            return false;
+        }
+        place(K(key), V(value));
+        ++size_;
+        return true;
+    }
+
+    V* find(const K& key) noexcept
+    {
+        return const_cast<V*>(std::as_const(*this).find(key));
+    }
+
+    const V* find(const K& key) const noexcept
+    {
+        if (size_ == 0) return nullptr;
+        const bucket* b = buckets_.get();
+        for (std::size_t i = home(key);; i = (i + 1) & (bucket_count_ - 1)) {
+            if (!b[i].occupied) return nullptr;
+            if (b[i].key() == key) return &b[i].value();
+        }
+    }
+
+    bool contains(const K& key) const noexcept { return find(key) != nullptr; }
+
+    bool erase(const K& key) noexcept
+    {
+        if (size_ == 0) return false;
+        bucket* b = buckets_.get();
+        const std::size_t mask = bucket_count_ - 1;
+
+        std::size_t i = home(key);
+        for (;; i = (i + 1) & mask) {
+            if (!b[i].occupied) return false;
+            if (b[i].key() == key) break;
+        }
+        b[i].destroy();
+
+        // Backward-shift: pull later entries of the probe run into the hole
+        // unless that would move them before their home bucket.
+        for (std::size_t j = (i + 1) & mask; b[j].occupied; j = (j + 1) & mask) {
+            const std::size_t h = home(b[j].key());
+            if (((j - h) & mask) >= ((j - i) & mask)) {
+                b[i].emplace(std::move(b[j].key()), std::move(b[j].value()));
+                b[j].destroy();
+                i = j;
+            }
+        }
+        --size_;
+        return true;
+    }
+
+    void clear() noexcept
+    {
+        bucket* b = buckets_.get();
+        for (std::size_t i = 0; i < bucket_count_; ++i) {
+            if (b[i].occupied) b[i].destroy();
+        }
+        size_ = 0;
+    }
+
+    // Invoke f(const K&, V&) for every entry, in bucket order.
+    template <class F>
+    void for_each(F&& f)
+    {
+        bucket* b = buckets_.get();
+        for (std::size_t i = 0; i < bucket_count_; ++i) {
+            if (b[i].occupied) f(std::as_const(b[i].key()), b[i].value());
+        }
+    }
+
+private:
+    struct bucket {
+        bool occupied;
+        alignas(K) unsigned char key_storage[sizeof(K)];
+        alignas(V) unsigned char value_storage[sizeof(V)];
+
+        K& key() noexcept { return *std::launder(reinterpret_cast<K*>(key_storage)); }
+        const K& key() const noexcept { return *std::launder(reinterpret_cast<const K*>(key_storage)); }
+        V& value() noexcept { return *std::launder(reinterpret_cast<V*>(value_storage)); }
+        const V& value() const noexcept { return *std::launder(reinterpret_cast<const V*>(value_storage)); }
+
+        void emplace(K&& k, V&& v) noexcept
+        {
+            ::new (static_cast<void*>(key_storage)) K(std::move(k));
+            ::new (static_cast<void*>(value_storage)) V(std::move(v));
+            occupied = true;
+        }
+
+        void destroy() noexcept
+        {
+            key().~K();
+            value().~V();
+            occupied = false;
+        }
+    };
+
+    std::size_t home(const K& key) const noexcept
+    {
+        const auto h = static_cast<std::uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<std::size_t>(h >> (64 - shift_));
+    }
+
+    void place(K&& key, V&& value) noexcept
+    {
+        bucket* b = buckets_.get();
+        std::size_t i = home(key);
+        while (b[i].occupied) {
+            i = (i + 1) & (bucket_count_ - 1);
+        }
+        b[i].emplace(std::move(key), std::move(value));
+    }
+
+    bool rehash(std::size_t new_count) noexcept
+    {
+        auto* fresh = static_cast<bucket*>(heap_->allocate(new_count * sizeof(bucket), alignof(bucket)));
+        if (!fresh) return false;
+        for (std::size_t i = 0; i < new_count; ++i) {
+            fresh[i].occupied = false;
+        }
+
+        bucket* old = buckets_.get();
+        const std::size_t old_count = bucket_count_;
+        buckets_ = fresh;
+        bucket_count_ = new_count;
+        shift_ = static_cast<unsigned>(std::countr_zero(new_count));
+
+        for (std::size_t i = 0; i < old_count; ++i) {
+            if (old[i].occupied) {
+                place(std::move(old[i].key()), std::move(old[i].value()));
+                old[i].destroy();
+            }
+        }
+        if (old) {
+            heap_->deallocate(old, old_count * sizeof(bucket), alignof(bucket));
+        }
+        return true;
+    }
+
+    offset_ptr<shm_heap> heap_{};
+    offset_ptr<bucket> buckets_{};
+    std::size_t bucket_count_{};
+    std::size_t size_{};
+    unsigned shift_{};
+};
+
+} // namespace hpc::ipc
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include <hpc/core/ttas_spinlock.hpp>
+#include <hpc/ipc/offset_ptr.hpp>
+#include <hpc/ipc/shm_ring_buffer.hpp>
+
+namespace hpc::ipc {
+
+// Position-independent free-list allocator living inside a shared-memory
+// region. The heap object sits at the start of the region and manages the
+// bytes that follow it; every link is an offset_ptr, so any process mapping
+// the region (at any address) can allocate and free.
+//
+// Design notes:
+//  - Power-of-two size classes from 16 bytes up; each class has its own
+//    free list threaded through freed blocks. New blocks are carved from a
+//    bump offset. Internal fragmentation is at most 2x, in exchange for O(1)
+//    allocate/deallocate with no per-block header.
+//  - Blocks are aligned to min(class size, cache line) relative to the
+//    region start, which is page-aligned in every mapping.
+//  - A ttas_spinlock in the region serializes allocation across threads and
+//    processes; the containers built on top are not synchronized.
+//  - A single root pointer lets other processes find the top-level object.
+
+class shm_heap {
+public:
+    // Construct a heap at the start of [base, base + bytes). Returns nullptr
+    // if the region is too small or base is not cache-line aligned.
+    static shm_heap* create(void* base, std::size_t bytes) noexcept;
+    static shm_heap* create(shm_region& region) noexcept { return create(region.address(), region.size()); }
+
+    // Attach to a heap previously created in the region. Returns nullptr if
+    // the region does not start with a heap.
+    static shm_heap* attach(void* base) noexcept;
+    static shm_heap* attach(shm_region& region) noexcept { return attach(region.address()); }
+
+    shm_heap(const shm_heap&) = delete;
+    shm_heap& operator=(const shm_heap&) = delete;
+
+    // Alignment up to the cache line size is supported; larger requests
+    // return nullptr, as does exhaustion.
+    [[nodiscard]] void* allocate(std::size_t bytes,
+                                 std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+    // `bytes` and `alignment` must match the values passed to allocate().
+    void deallocate(void* p, std::size_t bytes,
+                    std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+    template <class T, class... Args>
+    T* construct(Args&&... args)
+    {
+        void* p = allocate(sizeof(T), alignof(T));
+        if (!p) return nullptr;
+        return ::new (p) T(std::forward<Args>(args)...);
+    }
+
+    template <class T>
+    void destroy(T* p) noexcept
+    {
+        if (!p) return;
+        p->~T();
+        deallocate(p, sizeof(T), alignof(T));
+    }
+
+    void set_root(void* p) noexcept { root_ = p; }
+
+    template <class T>
+    T* root() const noexcept { return static_cast<T*>(root_.get()); }
+
+    // Bytes managed by the heap (excluding the heap object itself).
+    std::size_t capacity() const noexcept { return static_cast<std::size_t>(size_ - data_begin()); }
+    // Bytes carved from the bump region so far, including freed blocks.
+    std::size_t carved() const noexcept { return static_cast<std::size_t>(bump_ - data_begin()); }
+
+private:
+    static constexpr std::size_t min_class_shift = 4; // 16 bytes
+    static constexpr std::size_t class_count = 44;    // up to 2^47 bytes
+
+    struct free_block {
+        offset_ptr<free_block> next;
+    };
+
+    explicit shm_heap(std::size_t size) noexcept;
+
+    static std::size_t size_class(std::size_t bytes) noexcept;
+    std::uint64_t data_begin() const noexcept;
+    std::byte* base() noexcept { return reinterpret_cast<std::byte*>(this); }
+
+    std::uint64_t magic_{};
+    std::uint64_t size_{}; // region bytes, heap object included
+    std::uint64_t bump_{}; // next uncarved offset from the region start
+    hpc::core::ttas_spinlock lock_{};
+    offset_ptr<void> root_{};
+    offset_ptr<free_block> free_lists_[class_count]{};
+};
+
+} // namespace hpc::ipc
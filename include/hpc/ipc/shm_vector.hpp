@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <hpc/ipc/offset_ptr.hpp>
+#include <hpc/ipc/shm_heap.hpp>
+
+namespace hpc::ipc {
+
+// Growable array placed in a shared-memory region and allocating from an
+// shm_heap in the same region. All internal pointers are offset_ptrs, so the
+// vector can be read (and, with external synchronization, modified) from any
+// process mapping the region. Element access is one add on top of the
+// offset_ptr's own address.
+//
+// Growth failures (heap exhaustion) are reported by return value rather than
+// exceptions, matching the other allocation paths in this library.
+
+template <class T>
+class shm_vector {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "T must be nothrow move constructible for in-place growth");
+
+public:
+    using value_type = T;
+
+    explicit shm_vector(shm_heap& heap) noexcept : heap_(&heap) {}
+
+    ~shm_vector()
+    {
+        clear();
+        release();
+    }
+
+    shm_vector(const shm_vector&) = delete;
+    shm_vector& operator=(const shm_vector&) = delete;
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    T* data() noexcept { return data_.get(); }
+    const T* data() const noexcept { return data_.get(); }
+
+    T& operator[](std::size_t i) noexcept { return data_[static_cast<std::ptrdiff_t>(i)]; }
+    const T& operator[](std::size_t i) const noexcept { return data_[static_cast<std::ptrdiff_t>(i)]; }
+
+    T* begin() noexcept { return data(); }
+    T* end() noexcept { return data() + size_; }
+    const T* begin() const noexcept { return data(); }
+    const T* end() const noexcept { return data() + size_; }
+
+    // Returns false if the heap cannot satisfy the allocation.
+    bool reserve(std::size_t n) noexcept
+    {
+        if (n <= capacity_) return true;
+
+        T* fresh = static_cast<T*>(heap_->allocate(n * sizeof(T), alignof(T)));
+        if (!fresh) return false;
+
+        T* old = data();
+        for (std::size_t i = 0; i < size_; ++i) {
+            ::new (static_cast<void*>(fresh + i)) T(std::move(old[i]));
+            old[i].~T();
+        }
+        release();
+        data_ = fresh;
+        capacity_ = n;
+        return true;
+    }
+
+    // Returns a pointer to the new element, or nullptr on heap exhaustion.
+    template <class... Args>
+    T* emplace_back(Args&&... args)
+    {
+        if (size_ == capacity_ && !reserve(capacity_ ? capacity_ * 2 : 4)) {
+            return nullptr;
+        }
+        T* slot = data() + size_;
+        ::new (static_cast<void*>(slot)) T(std::forward<Args>(args)...);
+        ++size_;
+        return slot;
+    }
+
+    bool push_back(const T& value) { return emplace_back(value) != nullptr; }
+    bool push_back(T&& value) { return emplace_back(std::move(value)) != nullptr; }
+
+    void pop_back() noexcept
+    {
+        --size_;
+        data()[size_].~T();
+    }
+
+    void clear() noexcept
+    {
+        T* p = data();
+        for (std::size_t i = 0; i < size_; ++i) {
+            p[i].~T();
+        }
+        size_ = 0;
+    }
+
+private:
+    void release() noexcept
+    {
+        if (data_) {
+            heap_->deallocate(data_.get(), capacity_ * sizeof(T), alignof(T));
+            data_ = nullptr;
+            capacity_ = 0;
+        }
+    }
+
+    offset_ptr<shm_heap> heap_{};
+    offset_ptr<T> data_{};
+    std::size_t size_{};
+    std::size_t capacity_{};
+};
+
+} // namespace hpc::ipc
@@ -1,11 +1,51 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HPC_HAS_SSE2_STREAMING 1
+#else
+#define HPC_HAS_SSE2_STREAMING 0
+#endif
 
 namespace hpc::support {
 
-// Conservative default cache line size; can be specialized per-platform.
+// Coherence granule: the unit for alignment, prefetching and slab coloring.
+// Override with -DHPC_CACHE_LINE_SIZE=N (the CMake option of the same name),
+// e.g. 128 for Apple arm64 cores.
+#if defined(HPC_CACHE_LINE_SIZE)
+inline constexpr std::size_t cache_line_size = HPC_CACHE_LINE_SIZE;
+#else
 inline constexpr std::size_t cache_line_size = 64;
+#endif
+
+// Minimum distance between two variables written by different threads
+// (padded ring indices, per-thread counters, lock words). On x86 the L2
+// spatial prefetcher fetches 64-byte lines in 128-byte aligned pairs, so two
+// writers one line apart still steal each other's lines; padding to 128
+// removes that. Override with -DHPC_DESTRUCTIVE_INTERFERENCE_SIZE=N (CMake
+// option HPC_DESTRUCTIVE_INTERFERENCE_SIZE=64|128|auto).
+#if defined(HPC_DESTRUCTIVE_INTERFERENCE_SIZE)
+inline constexpr std::size_t destructive_interference_size = HPC_DESTRUCTIVE_INTERFERENCE_SIZE;
+#elif defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+inline constexpr std::size_t destructive_interference_size = 128;
+#else
+inline constexpr std::size_t destructive_interference_size = cache_line_size;
+#endif
+
+static_assert((cache_line_size & (cache_line_size - 1)) == 0, "cache_line_size must be a power of two");
+static_assert((destructive_interference_size & (destructive_interference_size - 1)) == 0
+                  && destructive_interference_size >= cache_line_size,
+              "destructive_interference_size must be a power of two and at least cache_line_size");
+
+// Data cache line size reported by the running CPU (sysfs, then CPUID on
+// x86, then sysconf), or 0 if unknown. For diagnostics: compare it against
+// cache_line_size to catch a build tuned for a different machine.
+std::size_t runtime_cache_line_size() noexcept;
 
 // Prefetch a cache line for read.
 inline void prefetch_for_read(const void* ptr) noexcept
@@ -31,5 +71,61 @@ inline void prefetch_for_write(const void* ptr) noexcept
 #endif
 }
 
-} // namespace hpc::support
+// Prefetch every cache line overlapping [ptr, ptr + bytes) for read.
+inline void prefetch_range_for_read(const void* ptr, std::size_t bytes) noexcept
+{
+    auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+    const auto end = addr + bytes;
+    addr &= ~static_cast<std::uintptr_t>(cache_line_size - 1);
+    for (; addr < end; addr += cache_line_size) {
+        prefetch_for_read(reinterpret_cast<const void*>(addr));
+    }
+}
 
+// Copy `bytes` from src to dst using non-temporal (streaming) stores where
+// the platform supports them, so the destination lines are written to memory
+// without being pulled into, or evicting, the writer's cache. Intended for
+// large payloads the writer never reads back. Unaligned head/tail bytes and
+// platforms without streaming stores fall back to memcpy.
+//
+// Streaming stores are weakly ordered: callers must issue store_fence() before
+// publishing the destination to another thread.
+inline void stream_copy(void* dst, const void* src, std::size_t bytes) noexcept
+{
+#if HPC_HAS_SSE2_STREAMING
+    auto* d = static_cast<std::byte*>(dst);
+    const auto* s = static_cast<const std::byte*>(src);
+
+    const auto misalign = reinterpret_cast<std::uintptr_t>(d) & 15u;
+    if (misalign != 0) {
+        const std::size_t head = bytes < 16 - misalign ? bytes : 16 - misalign;
+        std::memcpy(d, s, head);
+        d += head;
+        s += head;
+        bytes -= head;
+    }
+
+    for (; bytes >= 16; bytes -= 16, d += 16, s += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(d), v);
+    }
+
+    if (bytes != 0) {
+        std::memcpy(d, s, bytes);
+    }
+#else
+    std::memcpy(dst, src, bytes);
+#endif
+}
+
+// Order all preceding (including streaming) stores before subsequent stores.
+inline void store_fence() noexcept
+{
+#if HPC_HAS_SSE2_STREAMING
+    _mm_sfence();
+#else
+    std::atomic_thread_fence(std::memory_order_release);
+#endif
+}
+
+} // namespace hpc::support
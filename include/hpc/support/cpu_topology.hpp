@@ -1,6 +1,7 @@
 #pragma once
 
 #include <thread>
+#include <vector>
 
 namespace hpc::support {
 
@@ -8,5 +9,24 @@ namespace hpc::support {
 // On platforms where this is not supported, this is a no-op and returns false.
 bool pin_thread_to_core(std::thread& thread, unsigned core_id) noexcept;
 
-} // namespace hpc::support
+// Online NUMA node ids in ascending order (Linux sysfs node/online). Ids can
+// be sparse, e.g. {0, 2}. {0} when the topology cannot be determined.
+std::vector<int> online_numa_nodes();
+
+// One past the highest online NUMA node id, i.e. a bound for node-indexed
+// tables; equal to the number of nodes unless ids are sparse. Returns 1 when
+// the topology cannot be determined.
+int numa_node_count() noexcept;
+
+// Logical CPUs belonging to the given NUMA node, in ascending order. Empty
+// when the node does not exist or the topology cannot be determined.
+std::vector<unsigned> cores_of_node(int node);
 
+// SLIT distances between NUMA nodes from sysfs: distance[i][j] is the
+// relative cost for node i to reach memory on node j (10 = local), indexed by
+// node id up to numa_node_count(). Entries involving ids that are not online,
+// or whose distance file cannot be read, are -1 (the diagonal of online nodes
+// is always 10). {{10}} when the topology cannot be determined.
+std::vector<std::vector<int>> numa_distance_matrix();
+
+} // namespace hpc::support
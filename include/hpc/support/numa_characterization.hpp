@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hpc::support {
+
+// Measured memory cost between NUMA nodes on this machine.
+//
+// The hpc_numa_characterize tool fills one of these by pinning a thread to
+// each node in turn and reading memory bound to every node; the result is
+// saved as JSON and loaded back here so placement code can rank nodes by
+// what the hardware actually does rather than by the firmware's SLIT
+// distances alone. Row index = node of the reading CPU, column index = node
+// holding the memory.
+//
+// JSON layout (the tool's output, also accepted by from_json):
+//   {
+//     "nodes": 2,
+//     "distance":       [[10, 21], [21, 10]],
+//     "latency_ns":     [[92.1, 141.7], [140.9, 91.8]],
+//     "bandwidth_gbps": [[11.2, 7.9], [8.0, 11.4]]
+//   }
+// latency_ns and bandwidth_gbps may be empty (distance-only files).
+
+struct numa_characterization {
+    int nodes = 0;
+    std::vector<std::vector<int>> distance;
+    std::vector<std::vector<double>> latency_ns;     // per dependent load
+    std::vector<std::vector<double>> bandwidth_gbps; // sequential read, 1 thread
+
+    bool has_measurements() const noexcept
+    {
+        return !latency_ns.empty() && !bandwidth_gbps.empty();
+    }
+};
+
+// Distances only (numa_distance_matrix()); no measurements.
+numa_characterization numa_characterization_from_topology();
+
+std::string to_json(const numa_characterization& c);
+
+// Parse the layout above. Throws std::runtime_error on malformed input or
+// matrices whose shape does not match "nodes".
+numa_characterization numa_characterization_from_json(std::string_view json);
+
+// Throws std::runtime_error if the file cannot be read or parsed.
+numa_characterization load_numa_characterization(const std::string& path);
+
+// Throws std::runtime_error if the file cannot be written.
+void save_numa_characterization(const numa_characterization& c, const std::string& path);
+
+// Memory nodes ordered from cheapest to most expensive for a thread on
+// cpu_node: by measured latency when available, else by distance. Unmeasured
+// pairs (latency <= 0) come after all measured ones; nodes at a negative
+// distance (not online) are left out. Ties keep ascending node order. Empty
+// if cpu_node is out of range.
+std::vector<int> nodes_by_proximity(const numa_characterization& c, int cpu_node);
+
+} // namespace hpc::support
@@ -0,0 +1,103 @@
+#include <hpc/core/actor.hpp>
+
+#include <hpc/core/backoff.hpp>
+#include <hpc/support/cpu_topology.hpp>
+
+namespace hpc::core {
+
+actor_scheduler::actor_scheduler(const actor_scheduler_config& cfg)
+    : worker_count_(cfg.worker_count == 0 ? 1 : cfg.worker_count)
+    , cores_(cfg.cores)
+    , budget_(cfg.budget == 0 ? 1 : cfg.budget)
+    , max_actors_(cfg.max_actors)
+    , numa_node_(cfg.numa_node)
+    , arena_(cfg.arena_bytes)
+    , run_queue_(cfg.max_actors)
+    , stats_(std::make_unique<worker_stats[]>(worker_count_))
+{
+    actors_.reserve(max_actors_);
+}
+
+actor_scheduler::~actor_scheduler()
+{
+    stop();
+    for (auto it = actors_.rbegin(); it != actors_.rend(); ++it) {
+        (*it)->~actor();
+    }
+}
+
+void actor_scheduler::start()
+{
+    if (running_.exchange(true, std::memory_order_relaxed)) {
+        return;
+    }
+    threads_.reserve(worker_count_);
+    for (std::size_t i = 0; i < worker_count_; ++i) {
+        threads_.emplace_back([this, i] { worker_loop(i); });
+        if (!cores_.empty()) {
+            hpc::support::pin_thread_to_core(threads_.back(), cores_[i % cores_.size()]);
+        }
+    }
+}
+
+void actor_scheduler::stop()
+{
+    running_.store(false, std::memory_order_relaxed);
+    for (auto& t : threads_) {
+        t.join();
+    }
+    threads_.clear();
+}
+
+std::uint64_t actor_scheduler::activations() const noexcept
+{
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < worker_count_; ++i) {
+        total += stats_[i].activations.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+std::uint64_t actor_scheduler::messages_processed() const noexcept
+{
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < worker_count_; ++i) {
+        total += stats_[i].messages.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void actor_scheduler::worker_loop(std::size_t index) noexcept
+{
+    worker_stats& stats = stats_[index];
+    exponential_backoff idle;
+    actor* a = nullptr;
+
+    while (running_.load(std::memory_order_relaxed)) {
+        if (!run_queue_.try_pop(a)) {
+            if (!idle.pause()) {
+                std::this_thread::yield();
+            }
+            continue;
+        }
+        idle.reset();
+
+        const std::size_t n = a->run(budget_);
+        stats.activations.store(stats.activations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        stats.messages.store(stats.messages.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+
+        if (n == budget_) {
+            // Possibly more pending: stay scheduled, but let others run first.
+            enqueue(a);
+            continue;
+        }
+
+        a->scheduled_.store(false, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (a->has_messages() && !a->scheduled_.exchange(true, std::memory_order_acq_rel)) {
+            enqueue(a);
+        }
+    }
+}
+
+} // namespace hpc::core
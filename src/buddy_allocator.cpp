@@ -0,0 +1,210 @@
+#include <hpc/core/buddy_allocator.hpp>
+
+#include <bit>
+#include <new>
+#include <stdexcept>
+
+namespace hpc::core {
+
+namespace detail {
+
+summary_bitmap::summary_bitmap(std::size_t bits)
+{
+    std::size_t n = bits;
+    do {
+        const std::size_t words = (n + 63) / 64;
+        levels_.emplace_back(words, 0);
+        n = words;
+    } while (n > 1);
+}
+
+void summary_bitmap::set(std::size_t i) noexcept
+{
+    for (auto& level : levels_) {
+        std::uint64_t& word = level[i >> 6];
+        const bool was_empty = word == 0;
+        word |= std::uint64_t{1} << (i & 63);
+        if (!was_empty) {
+            return;
+        }
+        i >>= 6;
+    }
+}
+
+void summary_bitmap::clear(std::size_t i) noexcept
+{
+    for (auto& level : levels_) {
+        std::uint64_t& word = level[i >> 6];
+        word &= ~(std::uint64_t{1} << (i & 63));
+        if (word != 0) {
+            return;
+        }
+        i >>= 6;
+    }
+}
+
+std::size_t summary_bitmap::find_first() const noexcept
+{
+    std::size_t i = 0;
+    for (std::size_t l = levels_.size(); l-- > 0;) {
+        const std::uint64_t word = levels_[l][i];
+        if (word == 0) {
+            return npos;
+        }
+        i = (i << 6) | static_cast<std::size_t>(std::countr_zero(word));
+    }
+    return i;
+}
+
+} // namespace detail
+
+namespace {
+
+std::size_t round_up_pow2(std::size_t n) noexcept
+{
+    return n <= 1 ? 1 : std::bit_ceil(n);
+}
+
+} // namespace
+
+buddy_allocator::buddy_allocator(std::size_t capacity, std::size_t min_block, std::size_t max_block)
+{
+    min_block = round_up_pow2(min_block < 64 ? 64 : min_block);
+    max_block = round_up_pow2(max_block < min_block ? min_block : max_block);
+    if (capacity < max_block) {
+        max_block = std::bit_floor(capacity);
+    }
+    if (capacity < min_block || max_block < min_block) {
+        throw std::invalid_argument("buddy_allocator: capacity smaller than min_block");
+    }
+
+    min_shift_ = static_cast<unsigned>(std::countr_zero(min_block));
+    top_order_ = static_cast<unsigned>(std::countr_zero(max_block)) - min_shift_;
+    capacity_ = capacity / max_block * max_block;
+
+    region_ = hpc::support::huge_page_alloc(capacity_);
+    if (!region_.ptr) {
+        throw std::bad_alloc();
+    }
+    base_ = static_cast<std::byte*>(region_.ptr);
+
+    const std::size_t min_blocks = capacity_ >> min_shift_;
+    free_.reserve(top_order_ + 1);
+    for (unsigned k = 0; k <= top_order_; ++k) {
+        free_.emplace_back(min_blocks >> k);
+    }
+    free_count_.assign(top_order_ + 1, 0);
+    block_order_.assign(min_blocks, free_marker);
+
+    const std::size_t top_blocks = min_blocks >> top_order_;
+    for (std::size_t i = 0; i < top_blocks; ++i) {
+        free_[top_order_].set(i);
+    }
+    free_count_[top_order_] = top_blocks;
+    free_bytes_ = capacity_;
+}
+
+buddy_allocator::~buddy_allocator()
+{
+    hpc::support::huge_page_free(region_);
+}
+
+std::size_t buddy_allocator::order_for(std::size_t bytes) const noexcept
+{
+    if (bytes <= min_block()) {
+        return 0;
+    }
+    return static_cast<std::size_t>(std::bit_width(bytes - 1)) - min_shift_;
+}
+
+void* buddy_allocator::allocate(std::size_t bytes) noexcept
+{
+    const std::size_t order = order_for(bytes);
+    if (order > top_order_) {
+        return nullptr;
+    }
+
+    std::size_t k = order;
+    std::size_t index = detail::summary_bitmap::npos;
+    for (; k <= top_order_; ++k) {
+        if (free_count_[k] != 0) {
+            index = free_[k].find_first();
+            break;
+        }
+    }
+    if (index == detail::summary_bitmap::npos) {
+        return nullptr;
+    }
+    free_[k].clear(index);
+    --free_count_[k];
+
+    // Split down, keeping the lower half and freeing the upper buddy.
+    while (k > order) {
+        --k;
+        index <<= 1;
+        free_[k].set(index | 1);
+        ++free_count_[k];
+    }
+
+    const std::size_t first_min_block = index << order;
+    block_order_[first_min_block] = static_cast<std::uint8_t>(order);
+    free_bytes_ -= min_block() << order;
+    ++allocations_;
+    return base_ + (first_min_block << min_shift_);
+}
+
+void buddy_allocator::deallocate(void* p) noexcept
+{
+    if (!p) {
+        return;
+    }
+    const std::size_t first_min_block =
+        static_cast<std::size_t>(static_cast<std::byte*>(p) - base_) >> min_shift_;
+    std::size_t k = block_order_[first_min_block];
+    block_order_[first_min_block] = free_marker;
+    free_bytes_ += min_block() << k;
+    --allocations_;
+
+    std::size_t index = first_min_block >> k;
+    while (k < top_order_) {
+        const std::size_t buddy = index ^ 1;
+        if (!free_[k].test(buddy)) {
+            break;
+        }
+        free_[k].clear(buddy);
+        --free_count_[k];
+        index >>= 1;
+        ++k;
+    }
+    free_[k].set(index);
+    ++free_count_[k];
+}
+
+std::size_t buddy_allocator::block_size(const void* p) const noexcept
+{
+    const std::size_t first_min_block =
+        static_cast<std::size_t>(static_cast<const std::byte*>(p) - base_) >> min_shift_;
+    return min_block() << block_order_[first_min_block];
+}
+
+buddy_stats buddy_allocator::stats() const
+{
+    buddy_stats s;
+    s.capacity = capacity_;
+    s.free_bytes = free_bytes_;
+    s.allocations = allocations_;
+    s.free_blocks_per_order = free_count_;
+    for (std::size_t k = top_order_ + 1; k-- > 0;) {
+        if (free_count_[k] != 0) {
+            s.largest_free_block = min_block() << k;
+            break;
+        }
+    }
+    if (free_bytes_ != 0) {
+        s.external_fragmentation =
+            1.0 - static_cast<double>(s.largest_free_block) / static_cast<double>(free_bytes_);
+    }
+    return s;
+}
+
+} // namespace hpc::core
@@ -0,0 +1,144 @@
+#include <hpc/core/concurrent_arena.hpp>
+
+#include <new>
+
+namespace hpc::core {
+
+concurrent_arena::concurrent_arena(std::size_t capacity, std::size_t chunk_size)
+    : concurrent_arena(capacity, chunk_size, std::span<const int>{})
+{
+}
+
+concurrent_arena::concurrent_arena(std::size_t capacity, std::size_t chunk_size, std::span<const int> numa_nodes)
+    : capacity_(capacity)
+    , chunk_size_(chunk_size == 0 ? default_chunk_size : chunk_size)
+{
+    if (numa_nodes.empty()) {
+        region_ = hpc::support::huge_page_alloc(capacity_);
+        if (!region_.ptr) {
+            throw std::bad_alloc();
+        }
+        segment_count_ = 1;
+        segments_ = std::make_unique<segment[]>(1);
+        segments_[0].base = static_cast<std::byte*>(region_.ptr);
+        segments_[0].size = capacity_;
+        return;
+    }
+
+    segment_count_ = numa_nodes.size();
+    segments_ = std::make_unique<segment[]>(segment_count_);
+    const std::size_t per_node = capacity_ / segment_count_;
+    for (std::size_t i = 0; i < segment_count_; ++i) {
+        segment& seg = segments_[i];
+        seg.numa = std::make_unique<numa_arena>(per_node + hpc::support::cache_line_size, numa_nodes[i]);
+        seg.base = static_cast<std::byte*>(seg.numa->allocate(per_node, hpc::support::cache_line_size));
+        if (!seg.base) {
+            throw std::bad_alloc();
+        }
+        seg.size = per_node;
+        seg.node = seg.numa->node();
+    }
+}
+
+concurrent_arena::~concurrent_arena()
+{
+    hpc::support::huge_page_free(region_);
+}
+
+void concurrent_arena::reset() noexcept
+{
+    for (std::size_t i = 0; i < segment_count_; ++i) {
+        segments_[i].next.store(0, std::memory_order_relaxed);
+    }
+    epoch_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::size_t concurrent_arena::used() const noexcept
+{
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < segment_count_; ++i) {
+        const std::size_t next = segments_[i].next.load(std::memory_order_relaxed);
+        total += next < segments_[i].size ? next : segments_[i].size;
+    }
+    return total;
+}
+
+std::byte* concurrent_arena::carve(std::size_t first, std::size_t bytes) noexcept
+{
+    for (std::size_t k = 0; k < segment_count_; ++k) {
+        segment& seg = segments_[(first + k) % segment_count_];
+        // Cheap pre-check keeps exhausted segments from growing their
+        // overshoot without bound.
+        if (seg.next.load(std::memory_order_relaxed) + bytes > seg.size) {
+            continue;
+        }
+        const std::size_t offset = seg.next.fetch_add(bytes, std::memory_order_relaxed);
+        if (offset + bytes <= seg.size) {
+            return seg.base + offset;
+        }
+    }
+    return nullptr;
+}
+
+std::byte* concurrent_arena::carve_remainder(std::size_t first, std::size_t min_bytes, std::size_t max_bytes,
+                                             std::size_t& got) noexcept
+{
+    for (std::size_t k = 0; k < segment_count_; ++k) {
+        segment& seg = segments_[(first + k) % segment_count_];
+        std::size_t offset = seg.next.load(std::memory_order_relaxed);
+        // CAS rather than fetch_add: the amount taken depends on what is left.
+        while (offset <= seg.size && seg.size - offset >= min_bytes) {
+            const std::size_t take = seg.size - offset < max_bytes ? seg.size - offset : max_bytes;
+            if (seg.next.compare_exchange_weak(offset, offset + take, std::memory_order_relaxed)) {
+                got = take;
+                return seg.base + offset;
+            }
+        }
+    }
+    got = 0;
+    return nullptr;
+}
+
+concurrent_arena::thread_cache::thread_cache(concurrent_arena& arena, int numa_node) noexcept
+    : arena_(&arena)
+    , epoch_(arena.epoch_.load(std::memory_order_relaxed))
+{
+    for (std::size_t i = 0; i < arena.segment_count_; ++i) {
+        if (numa_node >= 0 && arena.segments_[i].node == numa_node) {
+            segment_ = i;
+            break;
+        }
+    }
+}
+
+void* concurrent_arena::thread_cache::refill(std::size_t bytes, std::size_t alignment) noexcept
+{
+    const std::size_t padded = bytes + alignment - 1;
+    if (padded > arena_->chunk_size_ / 2) {
+        // Large request: carve it on its own and keep the current chunk.
+        std::byte* p = arena_->carve(segment_, padded);
+        if (!p) {
+            return nullptr;
+        }
+        const auto addr = reinterpret_cast<std::uintptr_t>(p);
+        return reinterpret_cast<void*>((addr + alignment - 1) & ~(alignment - 1));
+    }
+
+    std::size_t chunk_bytes = arena_->chunk_size_;
+    std::byte* chunk = arena_->carve(segment_, chunk_bytes);
+    if (!chunk) {
+        // No whole chunk left anywhere (or the arena is smaller than one):
+        // take whatever tail still fits this request.
+        chunk = arena_->carve_remainder(segment_, padded, chunk_bytes, chunk_bytes);
+        if (!chunk) {
+            return nullptr;
+        }
+    }
+    cursor_ = reinterpret_cast<std::uintptr_t>(chunk);
+    end_ = cursor_ + chunk_bytes;
+    const std::uintptr_t aligned = (cursor_ + alignment - 1) & ~(alignment - 1);
+    cursor_ = aligned + bytes;
+    return reinterpret_cast<void*>(aligned);
+}
+
+} // namespace hpc::core
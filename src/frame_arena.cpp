@@ -0,0 +1,28 @@
+#include <hpc/core/frame_arena.hpp>
+
+namespace hpc::core {
+
+frame_arena::frame_arena(std::size_t bytes_per_frame, std::size_t frames)
+    : bytes_per_frame_(bytes_per_frame)
+{
+    if (frames == 0) {
+        frames = 1;
+    }
+    region_ = hpc::support::huge_page_alloc(bytes_per_frame_ * frames);
+    if (!region_.ptr) {
+        throw std::bad_alloc();
+    }
+    frames_.reserve(frames);
+    auto* base = static_cast<std::byte*>(region_.ptr);
+    for (std::size_t i = 0; i < frames; ++i) {
+        frames_.emplace_back(base + i * bytes_per_frame_, bytes_per_frame_);
+    }
+}
+
+frame_arena::~frame_arena()
+{
+    frames_.clear();
+    hpc::support::huge_page_free(region_);
+}
+
+} // namespace hpc::core
@@ -0,0 +1,694 @@
+#include <hpc/io/async_file_writer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if HPC_HAS_IO_URING
+#include <linux/io_uring.h>
+#endif
+
+namespace hpc::io {
+
+class async_file_writer::engine {
+public:
+    virtual ~engine() = default;
+
+    virtual bool is_io_uring() const noexcept = 0;
+
+    // Queue a request; may submit if a batch is complete.
+    virtual void queue(const write_request& req) = 0;
+
+    // Hand everything queued to the kernel (or worker).
+    virtual void submit() = 0;
+
+    // Append finished operations to `out` (a write and its fsync complete
+    // separately). With wait, block until at least one is available.
+    virtual void reap(bool wait, std::vector<completion>& out) = 0;
+};
+
+namespace {
+
+using engine = async_file_writer::engine;
+using write_request = async_file_writer::write_request;
+using completion = async_file_writer::completion;
+
+std::runtime_error sys_error(const char* what, int err)
+{
+    return std::runtime_error(std::string(what) + " failed: " + std::strerror(err));
+}
+
+#if HPC_HAS_IO_URING
+
+int io_uring_setup(unsigned entries, io_uring_params* params) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int io_uring_enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int io_uring_register(int ring_fd, unsigned opcode, const void* arg, unsigned nr_args) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+// Minimal io_uring driver over the raw syscalls: one SQ/CQ pair, registered
+// staging buffers and file, batched submission.
+class uring_engine final : public engine {
+public:
+    // Throws std::runtime_error if io_uring cannot be set up.
+    uring_engine(int fd, std::byte* base, std::size_t buffer_size, std::size_t buffer_count,
+                 std::size_t submit_batch)
+        : fd_(fd)
+        , base_(base)
+        , buffer_size_(buffer_size)
+        , submit_batch_(static_cast<unsigned>(submit_batch ? submit_batch : 1))
+    {
+        writes_.resize(buffer_count);
+        // Room for a write plus an fsync per buffer.
+        unsigned entries = 1;
+        while (entries < 2 * buffer_count) {
+            entries <<= 1;
+        }
+
+        io_uring_params params{};
+        ring_fd_ = io_uring_setup(entries, &params);
+        if (ring_fd_ < 0) {
+            throw sys_error("io_uring_setup", errno);
+        }
+        if (!map_rings(params)) {
+            const int err = errno;
+            release();
+            throw sys_error("io_uring mmap", err);
+        }
+
+        // Registration is an optimization; without it the engine issues
+        // plain WRITE against the regular descriptor.
+        std::vector<iovec> iovs(buffer_count);
+        for (std::size_t i = 0; i < buffer_count; ++i) {
+            iovs[i].iov_base = base_ + i * buffer_size_;
+            iovs[i].iov_len = buffer_size_;
+        }
+        fixed_buffers_ = io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS, iovs.data(),
+                                           static_cast<unsigned>(buffer_count)) == 0;
+        fixed_file_ = io_uring_register(ring_fd_, IORING_REGISTER_FILES, &fd_, 1) == 0;
+    }
+
+    ~uring_engine() override { release(); }
+
+    bool is_io_uring() const noexcept override { return true; }
+
+    void queue(const write_request& req) override
+    {
+        if (req.buffer != async_file_writer::no_buffer) {
+            writes_[req.buffer] = {req.offset, req.length, 0, req.fsync, false};
+            queue_write(req.buffer);
+        }
+        if (req.fsync) {
+            queue_fsync(req.buffer);
+        }
+        if (pending_ >= submit_batch_) {
+            submit();
+        }
+    }
+
+    void submit() override
+    {
+        while (pending_ != 0) {
+            std::atomic_ref<unsigned>(*sq_tail_).store(sq_tail_local_, std::memory_order_release);
+            const int ret = io_uring_enter(ring_fd_, pending_, 0, 0);
+            if (ret < 0) {
+                if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+                    continue;
+                }
+                throw sys_error("io_uring_enter", errno);
+            }
+            pending_ -= static_cast<unsigned>(ret);
+        }
+    }
+
+    void reap(bool wait, std::vector<completion>& out) override
+    {
+        for (;;) {
+            unsigned head = std::atomic_ref<unsigned>(*cq_head_).load(std::memory_order_relaxed);
+            const unsigned tail = std::atomic_ref<unsigned>(*cq_tail_).load(std::memory_order_acquire);
+            const bool any = head != tail;
+            for (; head != tail; ++head) {
+                const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+                const auto buffer = static_cast<std::uint32_t>(cqe.user_data >> 32);
+                if (buffer == async_file_writer::no_buffer) {
+                    // fsync; the low half names the write it was linked to.
+                    const auto linked = static_cast<std::uint32_t>(cqe.user_data);
+                    if (cqe.res == -ECANCELED && linked != async_file_writer::no_buffer
+                        && writes_[linked].relinked) {
+                        // Cancelled by a short write that was resubmitted
+                        // together with a new fsync; that one reports.
+                        writes_[linked].relinked = false;
+                        continue;
+                    }
+                    out.push_back({buffer, 0, cqe.res < 0 ? -cqe.res : 0});
+                    continue;
+                }
+
+                pending_write& w = writes_[buffer];
+                if (cqe.res > 0 && w.done + static_cast<std::uint32_t>(cqe.res) < w.length) {
+                    // Short write: resume after what was written, as the
+                    // pwritev engine does.
+                    w.done += static_cast<std::uint32_t>(cqe.res);
+                    queue_write(buffer);
+                    if (w.fsync) {
+                        w.relinked = true;
+                        queue_fsync(buffer);
+                    }
+                    continue;
+                }
+                int error = 0;
+                if (cqe.res < 0) {
+                    error = -cqe.res;
+                } else if (cqe.res == 0) {
+                    error = EIO; // no progress
+                }
+                out.push_back({buffer, w.length, error});
+            }
+            std::atomic_ref<unsigned>(*cq_head_).store(head, std::memory_order_release);
+
+            if (any || !wait) {
+                return;
+            }
+            submit();
+            if (io_uring_enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+                throw sys_error("io_uring_enter", errno);
+            }
+        }
+    }
+
+private:
+    // A write in flight; `done` bytes of it have completed so far.
+    struct pending_write {
+        std::uint64_t offset = 0;
+        std::uint32_t length = 0;
+        std::uint32_t done = 0;
+        bool fsync = false;    // an fsync is linked behind it
+        bool relinked = false; // resubmitted with a new fsync; drop the cancelled one
+    };
+
+    // Write the part of `buffer` not yet done.
+    void queue_write(std::uint32_t buffer)
+    {
+        const pending_write& w = writes_[buffer];
+        io_uring_sqe* sqe = next_sqe();
+        sqe->opcode = fixed_buffers_ ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+        sqe->flags = fixed_file_ ? IOSQE_FIXED_FILE : 0;
+        if (w.fsync) {
+            // A failed write cancels the fsync instead of reporting success.
+            sqe->flags |= IOSQE_IO_LINK;
+        }
+        sqe->fd = fixed_file_ ? 0 : fd_;
+        sqe->addr = reinterpret_cast<std::uint64_t>(base_ + std::size_t{buffer} * buffer_size_ + w.done);
+        sqe->len = w.length - w.done;
+        sqe->off = w.offset + w.done;
+        if (fixed_buffers_) {
+            sqe->buf_index = static_cast<std::uint16_t>(buffer);
+        }
+        sqe->user_data = encode(buffer, 0);
+    }
+
+    // fsync, linked behind the write of `linked` unless that is no_buffer.
+    void queue_fsync(std::uint32_t linked)
+    {
+        io_uring_sqe* sqe = next_sqe();
+        sqe->opcode = IORING_OP_FSYNC;
+        // Start only after every earlier submission has completed.
+        sqe->flags = static_cast<std::uint8_t>((fixed_file_ ? IOSQE_FIXED_FILE : 0) | IOSQE_IO_DRAIN);
+        sqe->fd = fixed_file_ ? 0 : fd_;
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+        sqe->user_data = encode(async_file_writer::no_buffer, linked);
+    }
+
+    static std::uint64_t encode(std::uint32_t buffer, std::uint32_t tag) noexcept
+    {
+        return (std::uint64_t{buffer} << 32) | tag;
+    }
+
+    bool map_rings(const io_uring_params& p) noexcept
+    {
+        sq_ring_bytes_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_ring_bytes_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        const bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single) {
+            sq_ring_bytes_ = cq_ring_bytes_ = std::max(sq_ring_bytes_, cq_ring_bytes_);
+        }
+
+        sq_ring_ = ::mmap(nullptr, sq_ring_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          ring_fd_, IORING_OFF_SQ_RING);
+        if (sq_ring_ == MAP_FAILED) {
+            sq_ring_ = nullptr;
+            return false;
+        }
+        if (single) {
+            cq_ring_ = sq_ring_;
+        } else {
+            cq_ring_ = ::mmap(nullptr, cq_ring_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                              ring_fd_, IORING_OFF_CQ_RING);
+            if (cq_ring_ == MAP_FAILED) {
+                cq_ring_ = nullptr;
+                return false;
+            }
+        }
+        sqes_bytes_ = p.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, sqes_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                            ring_fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            return false;
+        }
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        auto* sq = static_cast<std::byte*>(sq_ring_);
+        auto* cq = static_cast<std::byte*>(cq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+        sq_entries_ = p.sq_entries;
+        cq_head_ = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+        sq_tail_local_ = *sq_tail_;
+        return true;
+    }
+
+    io_uring_sqe* next_sqe()
+    {
+        // In-flight operations never exceed the ring size, but keep the
+        // kernel's view consistent if a caller queues faster than it submits.
+        while (sq_tail_local_ - std::atomic_ref<unsigned>(*sq_head_).load(std::memory_order_acquire)
+               >= sq_entries_) {
+            submit();
+        }
+        const unsigned index = sq_tail_local_ & sq_mask_;
+        io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sq_array_[index] = index;
+        ++sq_tail_local_;
+        ++pending_;
+        return sqe;
+    }
+
+    void release() noexcept
+    {
+        if (sqes_) ::munmap(sqes_, sqes_bytes_);
+        if (cq_ring_ && cq_ring_ != sq_ring_) ::munmap(cq_ring_, cq_ring_bytes_);
+        if (sq_ring_) ::munmap(sq_ring_, sq_ring_bytes_);
+        if (ring_fd_ >= 0) ::close(ring_fd_);
+        sqes_ = nullptr;
+        cq_ring_ = sq_ring_ = nullptr;
+        ring_fd_ = -1;
+    }
+
+    int fd_;
+    std::byte* base_;
+    std::size_t buffer_size_;
+    unsigned submit_batch_;
+
+    int ring_fd_{-1};
+    bool fixed_buffers_{};
+    bool fixed_file_{};
+
+    void* sq_ring_{};
+    void* cq_ring_{};
+    std::size_t sq_ring_bytes_{};
+    std::size_t cq_ring_bytes_{};
+    io_uring_sqe* sqes_{};
+    std::size_t sqes_bytes_{};
+
+    unsigned* sq_head_{};
+    unsigned* sq_tail_{};
+    unsigned* sq_array_{};
+    unsigned sq_mask_{};
+    unsigned sq_entries_{};
+    unsigned sq_tail_local_{}; // published to *sq_tail_ on submit
+    unsigned pending_{};       // queued but not yet submitted
+
+    unsigned* cq_head_{};
+    unsigned* cq_tail_{};
+    unsigned cq_mask_{};
+    io_uring_cqe* cqes_{};
+
+    std::vector<pending_write> writes_; // indexed by buffer
+};
+
+#endif // HPC_HAS_IO_URING
+
+// Fallback: a worker thread runs the requests in order with pwritev,
+// coalescing contiguous buffers into a single call.
+class thread_engine final : public engine {
+public:
+    thread_engine(int fd, std::byte* base, std::size_t buffer_size)
+        : fd_(fd)
+        , base_(base)
+        , buffer_size_(buffer_size)
+        , worker_([this] { run(); })
+    {
+    }
+
+    ~thread_engine() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_one();
+        worker_.join();
+    }
+
+    bool is_io_uring() const noexcept override { return false; }
+
+    void queue(const write_request& req) override { staged_.push_back(req); }
+
+    void submit() override
+    {
+        if (staged_.empty()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            requests_.insert(requests_.end(), staged_.begin(), staged_.end());
+        }
+        staged_.clear();
+        work_cv_.notify_one();
+    }
+
+    void reap(bool wait, std::vector<completion>& out) override
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (wait) {
+            done_cv_.wait(lock, [this] { return !done_.empty(); });
+        }
+        out.insert(out.end(), done_.begin(), done_.end());
+        done_.clear();
+    }
+
+private:
+    void run()
+    {
+        std::vector<write_request> batch;
+        std::vector<completion> finished;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                work_cv_.wait(lock, [this] { return stop_ || !requests_.empty(); });
+                if (requests_.empty()) return; // stop requested and nothing left
+                batch.swap(requests_);
+            }
+
+            finished.clear();
+            execute(batch, finished);
+            batch.clear();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_.insert(done_.end(), finished.begin(), finished.end());
+            }
+            done_cv_.notify_one();
+        }
+    }
+
+    void execute(const std::vector<write_request>& batch, std::vector<completion>& finished)
+    {
+        std::vector<iovec> iovs;
+        std::size_t i = 0;
+        while (i < batch.size()) {
+            // Gather a run of writes at contiguous offsets, ending at the
+            // first one that asks for an fsync.
+            std::size_t end = i;
+            iovs.clear();
+            while (end < batch.size() && batch[end].buffer != async_file_writer::no_buffer
+                   && iovs.size() < IOV_MAX
+                   && (end == i || batch[end].offset == batch[end - 1].offset + batch[end - 1].length)) {
+                iovs.push_back({base_ + std::size_t{batch[end].buffer} * buffer_size_, batch[end].length});
+                ++end;
+                if (batch[end - 1].fsync) break;
+            }
+
+            int error = 0;
+            if (end > i) {
+                error = write_all(iovs, batch[i].offset);
+                for (std::size_t k = i; k < end; ++k) {
+                    finished.push_back({batch[k].buffer, batch[k].length, error});
+                }
+            } else {
+                end = i + 1; // bare fsync
+            }
+
+            if (batch[end - 1].fsync) {
+                const int sync_error = error ? ECANCELED : (::fdatasync(fd_) == 0 ? 0 : errno);
+                finished.push_back({async_file_writer::no_buffer, 0, sync_error});
+            }
+            i = end;
+        }
+    }
+
+    int write_all(std::vector<iovec>& iovs, std::uint64_t offset) noexcept
+    {
+        iovec* iov = iovs.data();
+        int count = static_cast<int>(iovs.size());
+        auto pos = static_cast<off_t>(offset);
+        while (count > 0) {
+            const ssize_t n = ::pwritev(fd_, iov, count, pos);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return errno;
+            }
+            if (n == 0) {
+                return EIO; // no progress; retrying would spin
+            }
+            pos += n;
+            auto left = static_cast<std::size_t>(n);
+            while (count > 0 && left >= iov->iov_len) {
+                left -= iov->iov_len;
+                ++iov;
+                --count;
+            }
+            if (count > 0) {
+                iov->iov_base = static_cast<std::byte*>(iov->iov_base) + left;
+                iov->iov_len -= left;
+            }
+        }
+        return 0;
+    }
+
+    int fd_;
+    std::byte* base_;
+    std::size_t buffer_size_;
+
+    std::vector<write_request> staged_; // owner thread only
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::vector<write_request> requests_;
+    std::vector<completion> done_;
+    bool stop_{false};
+
+    std::thread worker_;
+};
+
+} // namespace
+
+async_file_writer::async_file_writer(const async_file_writer_config& cfg)
+{
+    constexpr std::size_t page = 4096;
+    const std::size_t count = cfg.buffer_count ? cfg.buffer_count : 1;
+    buffer_size_ = (std::max(cfg.buffer_size, page) + page - 1) & ~(page - 1);
+    if (buffer_size_ > UINT32_MAX) {
+        throw std::runtime_error("async_file_writer buffer_size too large");
+    }
+
+    const int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (cfg.truncate ? O_TRUNC : 0);
+    fd_ = ::open(cfg.path.c_str(), flags, 0644);
+    if (fd_ == -1) {
+        throw sys_error("open", errno);
+    }
+    if (!cfg.truncate) {
+        const off_t end = ::lseek(fd_, 0, SEEK_END);
+        appended_ = end > 0 ? static_cast<std::uint64_t>(end) : 0;
+    }
+
+    region_ = hpc::support::huge_page_alloc(buffer_size_ * count);
+    if (!region_.ptr) {
+        ::close(fd_);
+        throw std::runtime_error("async_file_writer: cannot allocate staging buffers");
+    }
+    auto* base = static_cast<std::byte*>(region_.ptr);
+
+    try {
+#if HPC_HAS_IO_URING
+        if (!cfg.force_fallback) {
+            try {
+                engine_ = std::make_unique<uring_engine>(fd_, base, buffer_size_, count, cfg.submit_batch);
+            } catch (const std::runtime_error&) {
+                // io_uring unavailable here (kernel, seccomp, limits).
+            }
+        }
+#endif
+        if (!engine_) {
+            engine_ = std::make_unique<thread_engine>(fd_, base, buffer_size_);
+        }
+    } catch (...) {
+        hpc::support::huge_page_free(region_);
+        ::close(fd_);
+        throw;
+    }
+
+    free_buffers_.reserve(count);
+    for (std::size_t i = count; i > 0; --i) {
+        free_buffers_.push_back(static_cast<std::uint32_t>(i - 1));
+    }
+    completions_.reserve(2 * count);
+}
+
+async_file_writer::~async_file_writer()
+{
+    // Destructors must not throw; errors were reportable via sync(). A
+    // failed flush() (e.g. a sticky write error) must not skip the wait:
+    // the buffers are freed below and may still be the target of writes.
+    try {
+        flush();
+    } catch (...) {
+    }
+    try {
+        wait();
+    } catch (...) {
+    }
+    engine_.reset();
+    hpc::support::huge_page_free(region_);
+    ::close(fd_);
+}
+
+void async_file_writer::append(std::span<const std::byte> data)
+{
+    throw_if_failed();
+    while (!data.empty()) {
+        if (current_ == no_buffer) {
+            while (free_buffers_.empty()) {
+                reap(true);
+                throw_if_failed();
+            }
+            current_ = free_buffers_.back();
+            free_buffers_.pop_back();
+            fill_ = 0;
+            current_offset_ = appended_;
+        }
+
+        const std::size_t n = std::min(buffer_size_ - fill_, data.size());
+        std::memcpy(buffer_at(current_) + fill_, data.data(), n);
+        fill_ += n;
+        appended_ += n;
+        data = data.subspan(n);
+
+        if (fill_ == buffer_size_) {
+            dispatch(false);
+            reap(false);
+        }
+    }
+}
+
+void async_file_writer::flush()
+{
+    throw_if_failed();
+    dispatch(false);
+    engine_->submit();
+}
+
+void async_file_writer::sync()
+{
+    throw_if_failed();
+    dispatch(true);
+    wait();
+}
+
+void async_file_writer::wait()
+{
+    engine_->submit();
+    while (in_flight_ != 0) {
+        reap(true);
+    }
+    throw_if_failed();
+}
+
+bool async_file_writer::uses_io_uring() const noexcept
+{
+    return engine_->is_io_uring();
+}
+
+void async_file_writer::dispatch(bool fsync)
+{
+    write_request req{no_buffer, 0, 0, fsync};
+    if (current_ != no_buffer) {
+        if (fill_ != 0) {
+            req = {current_, static_cast<std::uint32_t>(fill_), current_offset_, fsync};
+            ++in_flight_;
+            ++writes_issued_;
+        } else {
+            free_buffers_.push_back(current_);
+        }
+        current_ = no_buffer;
+        fill_ = 0;
+    }
+    if (req.buffer == no_buffer && !fsync) {
+        return;
+    }
+    if (fsync) {
+        ++in_flight_;
+    }
+    engine_->queue(req);
+}
+
+void async_file_writer::reap(bool wait)
+{
+    if (wait) {
+        engine_->submit();
+    }
+    completions_.clear();
+    engine_->reap(wait, completions_);
+    for (const completion& c : completions_) {
+        --in_flight_;
+        if (c.error != 0 && error_ == 0) {
+            error_ = c.error;
+        }
+        if (c.buffer != no_buffer) {
+            free_buffers_.push_back(c.buffer);
+            if (c.error == 0) {
+                completed_ += c.length;
+            }
+        }
+    }
+}
+
+void async_file_writer::throw_if_failed() const
+{
+    if (error_ != 0) {
+        throw sys_error("async file write", error_);
+    }
+}
+
+std::byte* async_file_writer::buffer_at(std::uint32_t index) const noexcept
+{
+    return static_cast<std::byte*>(region_.ptr) + std::size_t{index} * buffer_size_;
+}
+
+} // namespace hpc::io
@@ -0,0 +1,82 @@
+#include <hpc/io/udp_batch.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace hpc::io {
+
+namespace {
+
+std::runtime_error sys_error(const char* what, int err)
+{
+    return std::runtime_error(std::string(what) + " failed: " + std::strerror(err));
+}
+
+// Fill `addr` from a numeric IPv4 or IPv6 address; returns its length.
+socklen_t make_address(const char* ip, std::uint16_t port, sockaddr_in6& addr)
+{
+    std::memset(&addr, 0, sizeof(addr));
+    auto* v4 = reinterpret_cast<sockaddr_in*>(&addr);
+    if (::inet_pton(AF_INET, ip, &v4->sin_addr) == 1) {
+        v4->sin_family = AF_INET;
+        v4->sin_port = htons(port);
+        return sizeof(sockaddr_in);
+    }
+    if (::inet_pton(AF_INET6, ip, &addr.sin6_addr) == 1) {
+        addr.sin6_family = AF_INET6;
+        addr.sin6_port = htons(port);
+        return sizeof(sockaddr_in6);
+    }
+    throw std::runtime_error(std::string("invalid IP address: ") + ip);
+}
+
+} // namespace
+
+int open_udp_socket(const char* ip, std::uint16_t port, int rcvbuf_bytes)
+{
+    sockaddr_in6 addr{};
+    const socklen_t len = make_address(ip, port, addr);
+
+    const int fd = ::socket(addr.sin6_family, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd == -1) {
+        throw sys_error("socket", errno);
+    }
+    if (rcvbuf_bytes != 0) {
+        // Best effort: capped by net.core.rmem_max.
+        ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf_bytes, sizeof(rcvbuf_bytes));
+    }
+    if (::bind(fd, reinterpret_cast<const sockaddr*>(&addr), len) != 0) {
+        const int err = errno;
+        ::close(fd);
+        throw sys_error("bind", err);
+    }
+    return fd;
+}
+
+void connect_udp_socket(int fd, const char* ip, std::uint16_t port)
+{
+    sockaddr_in6 addr{};
+    const socklen_t len = make_address(ip, port, addr);
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&addr), len) != 0) {
+        throw sys_error("connect", errno);
+    }
+}
+
+std::uint16_t local_port(int fd)
+{
+    sockaddr_in6 addr{};
+    socklen_t len = sizeof(addr);
+    if (::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        throw sys_error("getsockname", errno);
+    }
+    // sin_port and sin6_port share an offset.
+    return ntohs(addr.sin6_port);
+}
+
+} // namespace hpc::io
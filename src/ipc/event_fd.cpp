@@ -0,0 +1,64 @@
+#include <hpc/ipc/event_fd.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace hpc::ipc {
+
+event_fd::event_fd()
+    : fd_(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+    if (fd_ == -1) {
+        throw std::runtime_error("eventfd failed: " + std::string(std::strerror(errno)));
+    }
+}
+
+event_fd::~event_fd()
+{
+    if (fd_ != -1) {
+        ::close(fd_);
+    }
+}
+
+void event_fd::signal() noexcept
+{
+    const std::uint64_t one = 1;
+    // Only fails with EAGAIN if the counter would overflow, in which case the
+    // descriptor is already readable.
+    [[maybe_unused]] auto written = ::write(fd_, &one, sizeof(one));
+}
+
+std::uint64_t event_fd::consume() noexcept
+{
+    std::uint64_t count = 0;
+    if (::read(fd_, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+        return 0; // EAGAIN: nothing pending
+    }
+    return count;
+}
+
+int create_epoll()
+{
+    const int fd = ::epoll_create1(EPOLL_CLOEXEC);
+    if (fd == -1) {
+        throw std::runtime_error("epoll_create1 failed: " + std::string(std::strerror(errno)));
+    }
+    return fd;
+}
+
+void epoll_add(int epoll_fd, int fd, std::uint64_t user_data, std::uint32_t events)
+{
+    epoll_event ev{};
+    ev.events = events;
+    ev.data.u64 = user_data;
+    if (::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+        throw std::runtime_error("epoll_ctl failed: " + std::string(std::strerror(errno)));
+    }
+}
+
+} // namespace hpc::ipc
@@ -0,0 +1,92 @@
+#include <hpc/ipc/shm_heap.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+#include <hpc/support/cache_line.hpp>
+
+namespace hpc::ipc {
+
+namespace {
+
+constexpr std::uint64_t kHeapMagic = 0x5041454848435048ull; // "HPCHHEAP" little-endian
+
+constexpr std::uint64_t align_up(std::uint64_t v, std::uint64_t a) noexcept
+{
+    return (v + a - 1) & ~(a - 1);
+}
+
+} // namespace
+
+shm_heap::shm_heap(std::size_t size) noexcept
+    : magic_(kHeapMagic)
+    , size_(size)
+{
+    bump_ = data_begin();
+}
+
+shm_heap* shm_heap::create(void* base, std::size_t bytes) noexcept
+{
+    const auto addr = reinterpret_cast<std::uintptr_t>(base);
+    if (!base || (addr & (hpc::support::cache_line_size - 1)) != 0 || bytes < sizeof(shm_heap)) {
+        return nullptr;
+    }
+    return ::new (base) shm_heap(bytes);
+}
+
+shm_heap* shm_heap::attach(void* base) noexcept
+{
+    if (!base) return nullptr;
+    auto* heap = static_cast<shm_heap*>(base);
+    return heap->magic_ == kHeapMagic ? heap : nullptr;
+}
+
+std::uint64_t shm_heap::data_begin() const noexcept
+{
+    return align_up(sizeof(shm_heap), hpc::support::cache_line_size);
+}
+
+std::size_t shm_heap::size_class(std::size_t bytes) noexcept
+{
+    if (bytes <= (std::size_t{1} << min_class_shift)) return 0;
+    return static_cast<std::size_t>(std::bit_width(bytes - 1)) - min_class_shift;
+}
+
+void* shm_heap::allocate(std::size_t bytes, std::size_t alignment) noexcept
+{
+    if (alignment > hpc::support::cache_line_size) return nullptr;
+
+    // Blocks are aligned to min(class size, cache line), so a class at least
+    // as large as the alignment satisfies it.
+    const std::size_t cls = size_class(std::max<std::size_t>({bytes, alignment, 1}));
+    if (cls >= class_count) return nullptr;
+    const std::uint64_t block = std::uint64_t{1} << (cls + min_class_shift);
+
+    std::scoped_lock guard(lock_);
+
+    if (free_block* b = free_lists_[cls].get()) {
+        free_lists_[cls] = b->next;
+        b->~free_block();
+        return b;
+    }
+
+    const std::uint64_t block_align = block < hpc::support::cache_line_size ? block : hpc::support::cache_line_size;
+    const std::uint64_t offset = align_up(bump_, block_align);
+    if (offset + block > size_) return nullptr;
+    bump_ = offset + block;
+    return base() + offset;
+}
+
+void shm_heap::deallocate(void* p, std::size_t bytes, std::size_t alignment) noexcept
+{
+    if (!p) return;
+    const std::size_t cls = size_class(std::max<std::size_t>({bytes, alignment, 1}));
+
+    std::scoped_lock guard(lock_);
+    auto* b = ::new (p) free_block{};
+    b->next = free_lists_[cls];
+    free_lists_[cls] = b;
+}
+
+} // namespace hpc::ipc
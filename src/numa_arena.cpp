@@ -1,6 +1,15 @@
 #include <hpc/core/numa_arena.hpp>
 
+#include <cstdint>
+#include <thread>
+#include <vector>
+
 #if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if HPC_HAS_NUMA
 #include <numa.h>
 #include <numaif.h>
 #endif
@@ -9,54 +18,235 @@ namespace hpc::core {
 
 namespace {
 
+#if HPC_HAS_NUMA
 static bool numa_available() noexcept
 {
-#if defined(__linux__)
     return ::numa_available() != -1;
-#else
-    return false;
+}
+
+int to_mpol_mode(numa_policy policy) noexcept
+{
+    switch (policy) {
+    case numa_policy::bind:       return MPOL_BIND;
+    case numa_policy::preferred:  return MPOL_PREFERRED;
+    case numa_policy::interleave: return MPOL_INTERLEAVE;
+    case numa_policy::local:      break;
+    }
+    return MPOL_LOCAL;
+}
 #endif
+
+#if defined(__linux__)
+std::size_t page_size() noexcept
+{
+    const long ps = ::sysconf(_SC_PAGESIZE);
+    return static_cast<std::size_t>(ps > 0 ? ps : 4096);
 }
+#endif
 
 } // namespace
 
 numa_arena::numa_arena(std::size_t size_bytes, int preferred_node) noexcept
-    : arena_(size_bytes)
-    , node_(preferred_node)
+    : policy_(preferred_node < 0 ? numa_policy::local : numa_policy::bind)
+{
+    const int nodes[] = {preferred_node};
+    map_and_apply(size_bytes, preferred_node < 0 ? std::span<const int>{} : std::span<const int>(nodes));
+}
+
+numa_arena::numa_arena(std::size_t size_bytes, numa_policy policy, std::span<const int> nodes) noexcept
+    : policy_(policy)
+{
+    map_and_apply(size_bytes, policy == numa_policy::local ? std::span<const int>{} : nodes);
+}
+
+numa_arena::~numa_arena()
 {
 #if defined(__linux__)
-    if (!numa_available() || preferred_node < 0) {
-        node_ = -1;
+    if (mapping_) {
+        ::munmap(mapping_, mapping_bytes_);
+    }
+#endif
+}
+
+void numa_arena::map_and_apply(std::size_t size_bytes, std::span<const int> nodes) noexcept
+{
+#if defined(__linux__)
+    // A fresh mapping has no pages yet, so the policy set below governs every
+    // page's first touch, including the arena's own.
+    const std::size_t ps = page_size();
+    const std::size_t bytes = (size_bytes + ps - 1) & ~(ps - 1);
+    if (bytes == 0) {
+        return;
+    }
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
         return;
     }
+    mapping_ = p;
+    mapping_bytes_ = bytes;
+    arena_ = hpc::core::arena(p, size_bytes);
+#else
+    arena_ = hpc::core::arena(size_bytes);
+#endif
 
-    // Best-effort: bind the arena backing memory to the preferred node.
-    void* base = arena_.data();
-    std::size_t len = arena_.capacity();
-    if (!base || len == 0) {
-        node_ = -1;
+#if HPC_HAS_NUMA
+    if (!mapping_ || !numa_available()) {
+        return;
+    }
+    if (policy_ != numa_policy::local && nodes.empty()) {
         return;
     }
+    // MPOL_PREFERRED takes the lowest set bit of the mask, so pass only the
+    // node the caller named first.
+    if (policy_ == numa_policy::preferred) {
+        nodes = nodes.first(1);
+    }
 
-    // Create a nodemask for the target node.
     struct bitmask* mask = ::numa_allocate_nodemask();
     if (!mask) {
-        node_ = -1;
         return;
     }
-
     ::numa_bitmask_clearall(mask);
-    if (preferred_node < static_cast<int>(mask->size)) {
-        ::numa_bitmask_setbit(mask, preferred_node);
-        ::mbind(base, len, MPOL_BIND, mask->maskp, mask->size, 0);
+    bool valid = true;
+    for (int n : nodes) {
+        if (n < 0 || static_cast<unsigned long>(n) >= mask->size) {
+            valid = false;
+            break;
+        }
+        ::numa_bitmask_setbit(mask, static_cast<unsigned>(n));
+    }
+    if (valid) {
+        const bool empty_mask = policy_ == numa_policy::local;
+        policy_applied_ = ::mbind(mapping_, mapping_bytes_, to_mpol_mode(policy_),
+                                  empty_mask ? nullptr : mask->maskp,
+                                  empty_mask ? 0 : mask->size + 1, 0) == 0;
     }
+    ::numa_free_nodemask(mask);
+
+    if (policy_applied_ && (policy_ == numa_policy::bind || policy_ == numa_policy::preferred)) {
+        node_ = nodes.front();
+    }
+#else
+    (void)nodes;
+#endif
+}
+
+numa_placement numa_arena::verify_placement() const
+{
+    numa_placement result;
+#if defined(__linux__)
+    const std::size_t ps = page_size();
+    result.pages_total = mapping_bytes_ / ps;
+#if HPC_HAS_NUMA
+    if (mapping_ && numa_available()) {
+        result.pages_per_node.assign(static_cast<std::size_t>(::numa_max_node()) + 1, 0);
 
+        constexpr std::size_t batch = 1024;
+        void* pages[batch];
+        int status[batch];
+        auto* base = static_cast<std::byte*>(mapping_);
+        for (std::size_t first = 0; first < result.pages_total; first += batch) {
+            const std::size_t n = result.pages_total - first < batch ? result.pages_total - first : batch;
+            for (std::size_t i = 0; i < n; ++i) {
+                pages[i] = base + (first + i) * ps;
+            }
+            // nodes == nullptr: query only, nothing moves.
+            if (::move_pages(0, n, pages, nullptr, status, 0) != 0) {
+                result.pages_not_present += n;
+                continue;
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                if (status[i] >= 0 && static_cast<std::size_t>(status[i]) < result.pages_per_node.size()) {
+                    ++result.pages_per_node[static_cast<std::size_t>(status[i])];
+                } else {
+                    ++result.pages_not_present;
+                }
+            }
+        }
+        return result;
+    }
+#endif
+    result.pages_not_present = result.pages_total;
+#endif
+    return result;
+}
+
+numa_migration_result numa_arena::migrate_to_node(int node, std::size_t chunk_bytes)
+{
+    numa_migration_result result;
+    const auto start = std::chrono::steady_clock::now();
+#if HPC_HAS_NUMA
+    if (!mapping_ || !numa_available() || node < 0 || node > ::numa_max_node()) {
+        return result;
+    }
+
+    // Rebind first so pages faulted in during the move already land on the
+    // target node.
+    struct bitmask* mask = ::numa_allocate_nodemask();
+    if (!mask) {
+        return result;
+    }
+    ::numa_bitmask_clearall(mask);
+    ::numa_bitmask_setbit(mask, static_cast<unsigned>(node));
+    const bool rebound = ::mbind(mapping_, mapping_bytes_, MPOL_BIND, mask->maskp, mask->size + 1, 0) == 0;
     ::numa_free_nodemask(mask);
+    if (!rebound) {
+        return result;
+    }
+    policy_ = numa_policy::bind;
+    policy_applied_ = true;
+    node_ = node;
+
+    const std::size_t ps = page_size();
+    const std::size_t total_pages = mapping_bytes_ / ps;
+    const std::size_t chunk_pages = chunk_bytes == 0 ? total_pages : (chunk_bytes + ps - 1) / ps;
+    std::vector<void*> pages;
+    std::vector<int> status;
+    std::vector<int> targets;
+    auto* base = static_cast<std::byte*>(mapping_);
+
+    for (std::size_t first = 0; first < total_pages; first += chunk_pages) {
+        const std::size_t n = total_pages - first < chunk_pages ? total_pages - first : chunk_pages;
+        pages.resize(n);
+        status.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            pages[i] = base + (first + i) * ps;
+        }
+
+        // Query, then move only resident pages that are elsewhere, so the
+        // byte count reflects real copies.
+        if (::move_pages(0, n, pages.data(), nullptr, status.data(), 0) != 0) {
+            continue;
+        }
+        std::size_t movable = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (status[i] >= 0 && status[i] != node) {
+                pages[movable++] = pages[i];
+            }
+        }
+        if (movable != 0) {
+            targets.assign(movable, node);
+            status.resize(movable);
+            const long rc = ::move_pages(0, movable, pages.data(), targets.data(), status.data(), MPOL_MF_MOVE);
+            for (std::size_t i = 0; i < movable; ++i) {
+                if (rc >= 0 && status[i] == node) {
+                    result.bytes_moved += ps;
+                } else {
+                    ++result.pages_failed;
+                }
+            }
+        }
+        if (chunk_bytes != 0) {
+            std::this_thread::yield();
+        }
+    }
+    result.ok = true;
 #else
-    (void)size_bytes;
-    (void)preferred_node;
+    (void)node;
+    (void)chunk_bytes;
 #endif
+    result.elapsed = std::chrono::steady_clock::now() - start;
+    return result;
 }
 
 } // namespace hpc::core
-
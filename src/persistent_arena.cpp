@@ -0,0 +1,174 @@
+#include <hpc/core/persistent_arena.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/vfs.h>
+#endif
+
+namespace hpc::core {
+
+namespace {
+
+constexpr std::uint64_t kMagic = 0x4150524148435048ull; // "HPCHARPA" little-endian
+constexpr std::uint32_t kFormatVersion = 1;
+
+#if defined(__linux__)
+constexpr long kHugetlbfsMagic = 0x958458f6;
+#endif
+
+[[noreturn]] void throw_errno(const char* what)
+{
+    throw std::runtime_error(std::string(what) + " failed: " + std::strerror(errno));
+}
+
+// Mapping granularity of the file system holding fd: the huge page size on
+// hugetlbfs, the regular page size otherwise.
+std::size_t mapping_granularity(int fd) noexcept
+{
+#if defined(__linux__)
+    struct statfs fs{};
+    if (::fstatfs(fd, &fs) == 0 && static_cast<long>(fs.f_type) == kHugetlbfsMagic && fs.f_bsize > 0) {
+        return static_cast<std::size_t>(fs.f_bsize);
+    }
+#else
+    (void)fd;
+#endif
+    const long page_size = ::sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? static_cast<std::size_t>(page_size) : 4096u;
+}
+
+} // namespace
+
+persistent_arena::persistent_arena(const persistent_arena_config& cfg)
+    : arena_(nullptr, 0)
+{
+    const int flags = cfg.create ? (O_CREAT | O_RDWR) : O_RDWR;
+    fd_ = ::open(cfg.path.c_str(), flags, 0600);
+    if (fd_ == -1) {
+        throw_errno("open");
+    }
+
+    if (::flock(fd_, LOCK_EX | LOCK_NB) != 0) {
+        ::close(fd_);
+        throw std::runtime_error("persistent_arena: " + cfg.path + " is in use by another process");
+    }
+
+    struct stat st{};
+    if (::fstat(fd_, &st) != 0) {
+        ::close(fd_);
+        throw_errno("fstat");
+    }
+
+    const std::size_t granularity = mapping_granularity(fd_);
+    const bool fresh = st.st_size == 0;
+
+    // New files put the data one granule in, so it is page-aligned (huge
+    // page-aligned on hugetlbfs); existing files keep the offset they record.
+    const std::size_t data_offset = granularity;
+    if (fresh) {
+        const std::size_t wanted = data_offset + cfg.capacity;
+        mapped_size_ = (wanted + granularity - 1) & ~(granularity - 1);
+        if (::ftruncate(fd_, static_cast<off_t>(mapped_size_)) != 0) {
+            ::close(fd_);
+            throw_errno("ftruncate");
+        }
+    } else {
+        mapped_size_ = static_cast<std::size_t>(st.st_size);
+        if (mapped_size_ < sizeof(persistent_arena_header)) {
+            ::close(fd_);
+            throw std::runtime_error("persistent_arena: " + cfg.path + " is too small to hold a header");
+        }
+    }
+
+    void* addr = ::mmap(nullptr, mapped_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (addr == MAP_FAILED) {
+        ::close(fd_);
+        throw_errno("mmap");
+    }
+    base_ = static_cast<std::byte*>(addr);
+    header_ = reinterpret_cast<persistent_arena_header*>(base_);
+
+    if (fresh) {
+        header_->magic = kMagic;
+        header_->format_version = kFormatVersion;
+        header_->layout_version = cfg.layout_version;
+        header_->data_offset = data_offset;
+        header_->capacity = mapped_size_ - data_offset;
+        header_->used = 0;
+        header_->root = 0;
+    } else {
+        const char* error = nullptr;
+        if (header_->magic != kMagic || header_->format_version != kFormatVersion) {
+            error = " is not a persistent_arena file";
+        } else if (header_->layout_version != cfg.layout_version) {
+            error = " has a different layout version";
+        } else if (header_->data_offset < sizeof(persistent_arena_header)
+                   || header_->data_offset > mapped_size_
+                   || header_->capacity > mapped_size_ - header_->data_offset
+                   || header_->used > header_->capacity) {
+            error = " has a corrupt header";
+        }
+        if (error) {
+            ::munmap(base_, mapped_size_);
+            ::close(fd_);
+            throw std::runtime_error("persistent_arena: " + cfg.path + error);
+        }
+        restored_ = true;
+        previous_clean_ = header_->clean_shutdown == 1;
+    }
+
+    // Rebuild the bump state on top of the mapped data region: replaying the
+    // previous bump offset as one allocation restores it exactly.
+    arena_ = arena(base_ + header_->data_offset, static_cast<std::size_t>(header_->capacity));
+    if (header_->used != 0) {
+        (void)arena_.allocate(static_cast<std::size_t>(header_->used), 1);
+    }
+
+    // Marked clean again only by an orderly destruction.
+    header_->clean_shutdown = 0;
+}
+
+persistent_arena::~persistent_arena()
+{
+    if (base_) {
+        header_->clean_shutdown = 1;
+        ::msync(base_, mapped_size_, MS_SYNC);
+        ::munmap(base_, mapped_size_);
+    }
+    if (fd_ != -1) {
+        ::close(fd_); // also releases the flock
+    }
+}
+
+void* persistent_arena::allocate(std::size_t bytes, std::size_t alignment) noexcept
+{
+    void* p = arena_.allocate(bytes, alignment);
+    if (p) {
+        header_->used = arena_.used();
+    }
+    return p;
+}
+
+void persistent_arena::reset() noexcept
+{
+    arena_.reset();
+    header_->used = 0;
+    header_->root = 0;
+}
+
+void persistent_arena::flush()
+{
+    if (::msync(base_, mapped_size_, MS_SYNC) != 0) {
+        throw_errno("msync");
+    }
+}
+
+} // namespace hpc::core
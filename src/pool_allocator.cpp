@@ -6,20 +6,47 @@
 namespace hpc::core {
 
 fixed_pool::fixed_pool(std::size_t element_size, std::size_t element_count)
+    : fixed_pool(element_size, element_count, pool_coloring{0})
+{
+}
+
+fixed_pool::fixed_pool(std::size_t element_size, std::size_t element_count, pool_coloring coloring)
     : element_size_(element_size < sizeof(node) ? sizeof(node) : element_size)
     , element_count_(element_count)
 {
+    if (coloring.slab_elements != 0) {
+        slab_elements_ = coloring.slab_elements;
+        color_step_ = hpc::support::cache_line_size;
+    }
+
     if (element_count_ == 0) {
         storage_ = nullptr;
         free_list_ = nullptr;
         return;
     }
 
-    storage_ = static_cast<std::byte*>(::operator new(element_size_ * element_count_));
+    const std::size_t slabs = (element_count_ + slab_elements_ - 1) / slab_elements_;
+    storage_bytes_ = element_size_ * element_count_ + slabs * color_step_;
+    storage_ = static_cast<std::byte*>(
+        ::operator new(storage_bytes_, std::align_val_t{hpc::support::cache_line_size}));
     free_list_ = nullptr;
 
-    for (std::size_t i = 0; i < element_count_; ++i) {
-        auto* n = reinterpret_cast<node*>(storage_ + i * element_size_);
+    for (std::size_t i = element_count_; i > 0; --i) {
+        auto* n = reinterpret_cast<node*>(element_at(i - 1));
+        n->next = free_list_;
+        free_list_ = n;
+    }
+}
+
+fixed_pool::fixed_pool(void* buffer, std::size_t element_size, std::size_t element_count)
+    : element_size_(element_size < sizeof(node) ? sizeof(node) : element_size)
+    , element_count_(buffer ? element_count : 0)
+    , storage_bytes_(element_size_ * element_count_)
+    , storage_(static_cast<std::byte*>(buffer))
+    , owns_storage_(false)
+{
+    for (std::size_t i = element_count_; i > 0; --i) {
+        auto* n = reinterpret_cast<node*>(element_at(i - 1));
         n->next = free_list_;
         free_list_ = n;
     }
@@ -27,7 +54,9 @@ fixed_pool::fixed_pool(std::size_t element_size, std::size_t element_count)
 
 fixed_pool::~fixed_pool()
 {
-    ::operator delete(storage_);
+    if (owns_storage_) {
+        ::operator delete(storage_, std::align_val_t{hpc::support::cache_line_size});
+    }
 }
 
 void* fixed_pool::allocate()
@@ -48,5 +77,26 @@ void fixed_pool::deallocate(void* p) noexcept
     free_list_ = n;
 }
 
-} // namespace hpc::core
+std::size_t fixed_pool::allocate_bulk(void** out, std::size_t n) noexcept
+{
+    node* head = free_list_;
+    std::size_t taken = 0;
+    for (; taken < n && head; ++taken) {
+        out[taken] = head;
+        head = head->next;
+    }
+    free_list_ = head;
+    return taken;
+}
 
+void fixed_pool::deallocate_bulk(void* const* in, std::size_t n) noexcept
+{
+    if (n == 0) return;
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        static_cast<node*>(in[i])->next = static_cast<node*>(in[i + 1]);
+    }
+    static_cast<node*>(in[n - 1])->next = free_list_;
+    free_list_ = static_cast<node*>(in[0]);
+}
+
+} // namespace hpc::core
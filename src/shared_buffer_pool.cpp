@@ -0,0 +1,160 @@
+#include <hpc/core/shared_buffer_pool.hpp>
+
+#include <new>
+
+namespace hpc::core {
+
+shared_buffer_pool::shared_buffer_pool(std::size_t buffer_size, std::size_t buffer_count)
+    : buffer_size_((buffer_size + hpc::support::cache_line_size - 1) & ~(hpc::support::cache_line_size - 1))
+    , buffer_count_(buffer_count)
+    , owner_thread_(std::this_thread::get_id())
+{
+    if (buffer_count_ == 0) {
+        return;
+    }
+
+    region_ = hpc::support::huge_page_alloc(buffer_size_ * buffer_count_);
+    if (!region_.ptr) {
+        throw std::bad_alloc();
+    }
+    headers_ = static_cast<detail::shared_buffer_header*>(::operator new[](
+        buffer_count_ * sizeof(detail::shared_buffer_header),
+        std::align_val_t{alignof(detail::shared_buffer_header)}));
+
+    auto* base = static_cast<std::byte*>(region_.ptr);
+    for (std::size_t i = buffer_count_; i > 0; --i) {
+        auto* h = ::new (static_cast<void*>(headers_ + (i - 1))) detail::shared_buffer_header{};
+        h->data = base + (i - 1) * buffer_size_;
+        h->owner = this;
+        h->next = local_free_;
+        local_free_ = h;
+    }
+    local_count_ = buffer_count_;
+}
+
+shared_buffer_pool::~shared_buffer_pool()
+{
+    if (headers_) {
+        for (std::size_t i = 0; i < buffer_count_; ++i) {
+            headers_[i].~shared_buffer_header();
+        }
+        ::operator delete[](headers_, std::align_val_t{alignof(detail::shared_buffer_header)});
+    }
+    hpc::support::huge_page_free(region_);
+}
+
+buffer_handle shared_buffer_pool::allocate(std::uint32_t refs) noexcept
+{
+    if (!local_free_) {
+        reclaim_remote();
+        if (!local_free_) {
+            return buffer_handle{};
+        }
+    }
+    detail::shared_buffer_header* h = local_free_;
+    local_free_ = h->next;
+    --local_count_;
+
+    h->size = 0;
+    h->refs.store(refs ? refs : 1, std::memory_order_relaxed);
+    return buffer_handle{h};
+}
+
+std::size_t shared_buffer_pool::allocate_bulk(buffer_handle* out, std::size_t n, std::uint32_t refs) noexcept
+{
+    if (local_count_ < n) {
+        reclaim_remote();
+    }
+    detail::shared_buffer_header* head = local_free_;
+    std::size_t taken = 0;
+    for (; taken < n && head; ++taken) {
+        head->size = 0;
+        head->refs.store(refs ? refs : 1, std::memory_order_relaxed);
+        out[taken] = buffer_handle{head};
+        head = head->next;
+    }
+    local_free_ = head;
+    local_count_ -= taken;
+    return taken;
+}
+
+void shared_buffer_pool::release(std::span<const buffer_handle> handles) noexcept
+{
+    // Chain of buffers freed so far, all owned by chain_owner.
+    shared_buffer_pool* chain_owner = nullptr;
+    detail::shared_buffer_header* first = nullptr;
+    detail::shared_buffer_header* last = nullptr;
+    std::size_t count = 0;
+
+    std::size_t i = 0;
+    while (i < handles.size()) {
+        std::size_t j = i + 1;
+        while (j < handles.size() && handles[j] == handles[i]) {
+            ++j;
+        }
+        detail::shared_buffer_header* h = handles[i].header_;
+        const auto refs = static_cast<std::uint32_t>(j - i);
+        i = j;
+        if (h->refs.fetch_sub(refs, std::memory_order_acq_rel) != refs) {
+            continue;
+        }
+        if (h->owner != chain_owner) {
+            if (chain_owner) {
+                chain_owner->recycle_chain(first, last, count);
+            }
+            chain_owner = h->owner;
+            first = last = h;
+            count = 1;
+            continue;
+        }
+        last->next = h;
+        last = h;
+        ++count;
+    }
+    if (chain_owner) {
+        chain_owner->recycle_chain(first, last, count);
+    }
+}
+
+std::size_t shared_buffer_pool::available() noexcept
+{
+    reclaim_remote();
+    return local_count_;
+}
+
+void shared_buffer_pool::recycle_chain(detail::shared_buffer_header* first,
+                                       detail::shared_buffer_header* last,
+                                       std::size_t count) noexcept
+{
+    if (std::this_thread::get_id() == owner_thread_) {
+        last->next = local_free_;
+        local_free_ = first;
+        local_count_ += count;
+        return;
+    }
+
+    // Treiber push of the whole chain; the release CAS publishes the
+    // consumer's last reads of the payloads before the owner can hand the
+    // buffers out again.
+    detail::shared_buffer_header* head = remote_free_.load(std::memory_order_relaxed);
+    do {
+        last->next = head;
+    } while (!remote_free_.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void shared_buffer_pool::reclaim_remote() noexcept
+{
+    if (!remote_free_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    detail::shared_buffer_header* list = remote_free_.exchange(nullptr, std::memory_order_acquire);
+    while (list) {
+        detail::shared_buffer_header* next = list->next;
+        list->next = local_free_;
+        local_free_ = list;
+        ++local_count_;
+        list = next;
+    }
+}
+
+} // namespace hpc::core
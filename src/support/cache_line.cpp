@@ -0,0 +1,52 @@
+#include <hpc/support/cache_line.hpp>
+
+#include <cstdio>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace hpc::support {
+
+std::size_t runtime_cache_line_size() noexcept
+{
+#if defined(__linux__)
+    // L1 data cache (index0) of cpu0; all cores share the line size.
+    if (FILE* f = std::fopen("/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size", "r")) {
+        unsigned size = 0;
+        const int matched = std::fscanf(f, "%u", &size);
+        std::fclose(f);
+        if (matched == 1 && size != 0) {
+            return size;
+        }
+    }
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+    // CPUID leaf 1, EBX[15:8]: CLFLUSH line size in 8-byte units.
+    unsigned eax = 0;
+    unsigned ebx = 0;
+    unsigned ecx = 0;
+    unsigned edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        const unsigned size = ((ebx >> 8) & 0xffu) * 8;
+        if (size != 0) {
+            return size;
+        }
+    }
+#endif
+
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_LINESIZE)
+    const long size = ::sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+    if (size > 0) {
+        return static_cast<std::size_t>(size);
+    }
+#endif
+    return 0;
+}
+
+} // namespace hpc::support
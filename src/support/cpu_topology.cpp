@@ -1,5 +1,8 @@
 #include <hpc/support/cpu_topology.hpp>
 
+#include <cstdio>
+#include <string>
+
 #if defined(__linux__)
 #include <pthread.h>
 #endif
@@ -22,5 +25,100 @@ bool pin_thread_to_core(std::thread& thread, unsigned core_id) noexcept
 #endif
 }
 
-} // namespace hpc::support
+#if defined(__linux__)
+namespace {
+
+// sysfs id list format: comma-separated ranges, e.g. "0-3,8-11".
+std::vector<unsigned> read_id_list(const std::string& path)
+{
+    std::vector<unsigned> ids;
+    FILE* f = std::fopen(path.c_str(), "r");
+    if (!f) {
+        return ids;
+    }
+
+    unsigned lo = 0;
+    for (;;) {
+        if (std::fscanf(f, "%u", &lo) != 1) break;
+        unsigned hi = lo;
+        int sep = std::fgetc(f);
+        if (sep == '-') {
+            if (std::fscanf(f, "%u", &hi) != 1) break;
+            sep = std::fgetc(f);
+        }
+        for (unsigned id = lo; id <= hi; ++id) {
+            ids.push_back(id);
+        }
+        if (sep != ',') break;
+    }
+    std::fclose(f);
+    return ids;
+}
 
+} // namespace
+#endif
+
+std::vector<int> online_numa_nodes()
+{
+    std::vector<int> nodes;
+#if defined(__linux__)
+    // "online" excludes hot-pluggable nodes that "possible" also lists.
+    for (unsigned id : read_id_list("/sys/devices/system/node/online")) {
+        nodes.push_back(static_cast<int>(id));
+    }
+#endif
+    if (nodes.empty()) {
+        nodes.push_back(0);
+    }
+    return nodes;
+}
+
+int numa_node_count() noexcept
+{
+    try {
+        return online_numa_nodes().back() + 1;
+    } catch (...) {
+        return 1;
+    }
+}
+
+std::vector<unsigned> cores_of_node(int node)
+{
+    std::vector<unsigned> cores;
+#if defined(__linux__)
+    if (node < 0) {
+        return cores;
+    }
+    cores = read_id_list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+#else
+    (void)node;
+#endif
+    return cores;
+}
+
+std::vector<std::vector<int>> numa_distance_matrix()
+{
+    const std::vector<int> online = online_numa_nodes();
+    const auto n = static_cast<std::size_t>(online.back() + 1);
+    std::vector<std::vector<int>> distance(n, std::vector<int>(n, -1));
+    for (int i : online) {
+        auto& row = distance[static_cast<std::size_t>(i)];
+        row[static_cast<std::size_t>(i)] = 10;
+#if defined(__linux__)
+        // One distance per online node, in ascending id order.
+        const std::string path = "/sys/devices/system/node/node" + std::to_string(i) + "/distance";
+        FILE* f = std::fopen(path.c_str(), "r");
+        if (!f) {
+            continue;
+        }
+        int d = 0;
+        for (std::size_t k = 0; k < online.size() && std::fscanf(f, "%d", &d) == 1; ++k) {
+            row[static_cast<std::size_t>(online[k])] = d;
+        }
+        std::fclose(f);
+#endif
+    }
+    return distance;
+}
+
+} // namespace hpc::support
@@ -0,0 +1,248 @@
+#include <hpc/support/numa_characterization.hpp>
+
+#include <hpc/support/cpu_topology.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace hpc::support {
+
+namespace {
+
+// Just enough JSON for the layout in the header: one flat object whose
+// values are numbers or arrays of arrays of numbers.
+class matrix_parser {
+public:
+    explicit matrix_parser(std::string_view text) noexcept : text_(text) {}
+
+    // Move just past `"key":`; false if the key is absent.
+    bool seek_key(std::string_view key)
+    {
+        const std::string quoted = '"' + std::string(key) + '"';
+        const std::size_t at = text_.find(quoted);
+        if (at == std::string_view::npos) {
+            return false;
+        }
+        pos_ = at + quoted.size();
+        expect(':');
+        return true;
+    }
+
+    double number()
+    {
+        skip_space();
+        double value = 0.0;
+        const char* first = text_.data() + pos_;
+        const char* last = text_.data() + text_.size();
+        const auto [end, ec] = std::from_chars(first, last, value);
+        if (ec != std::errc{}) {
+            fail("expected a number");
+        }
+        pos_ += static_cast<std::size_t>(end - first);
+        return value;
+    }
+
+    template <typename T>
+    std::vector<std::vector<T>> matrix()
+    {
+        std::vector<std::vector<T>> rows;
+        expect('[');
+        if (peek() == ']') {
+            ++pos_;
+            return rows;
+        }
+        for (;;) {
+            std::vector<T> row;
+            expect('[');
+            if (peek() != ']') {
+                for (;;) {
+                    row.push_back(static_cast<T>(number()));
+                    if (peek() != ',') break;
+                    ++pos_;
+                }
+            }
+            expect(']');
+            rows.push_back(std::move(row));
+            if (peek() != ',') break;
+            ++pos_;
+        }
+        expect(']');
+        return rows;
+    }
+
+private:
+    void skip_space() noexcept
+    {
+        while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\n' ||
+                                       text_[pos_] == '\r' || text_[pos_] == '\t')) {
+            ++pos_;
+        }
+    }
+
+    char peek() noexcept
+    {
+        skip_space();
+        return pos_ < text_.size() ? text_[pos_] : '\0';
+    }
+
+    void expect(char c)
+    {
+        if (peek() != c) {
+            fail(std::string("expected '") + c + "'");
+        }
+        ++pos_;
+    }
+
+    [[noreturn]] void fail(const std::string& what) const
+    {
+        throw std::runtime_error("numa_characterization: " + what + " at offset " + std::to_string(pos_));
+    }
+
+    std::string_view text_;
+    std::size_t pos_ = 0;
+};
+
+template <typename T>
+void check_shape(const std::vector<std::vector<T>>& m, int nodes, const char* name, bool optional)
+{
+    if (optional && m.empty()) {
+        return;
+    }
+    bool ok = m.size() == static_cast<std::size_t>(nodes);
+    for (const auto& row : m) {
+        ok = ok && row.size() == static_cast<std::size_t>(nodes);
+    }
+    if (!ok) {
+        throw std::runtime_error(std::string("numa_characterization: \"") + name +
+                                 "\" is not a nodes x nodes matrix");
+    }
+}
+
+template <typename T>
+void write_matrix(std::ostringstream& out, const std::vector<std::vector<T>>& m)
+{
+    out << '[';
+    for (std::size_t i = 0; i < m.size(); ++i) {
+        out << (i ? ", [" : "[");
+        for (std::size_t j = 0; j < m[i].size(); ++j) {
+            out << (j ? ", " : "") << m[i][j];
+        }
+        out << ']';
+    }
+    out << ']';
+}
+
+} // namespace
+
+numa_characterization numa_characterization_from_topology()
+{
+    numa_characterization c;
+    c.distance = numa_distance_matrix();
+    c.nodes = static_cast<int>(c.distance.size());
+    return c;
+}
+
+std::string to_json(const numa_characterization& c)
+{
+    std::ostringstream out;
+    out.precision(6);
+    out << "{\n  \"nodes\": " << c.nodes << ",\n  \"distance\": ";
+    write_matrix(out, c.distance);
+    out << ",\n  \"latency_ns\": ";
+    write_matrix(out, c.latency_ns);
+    out << ",\n  \"bandwidth_gbps\": ";
+    write_matrix(out, c.bandwidth_gbps);
+    out << "\n}\n";
+    return out.str();
+}
+
+numa_characterization numa_characterization_from_json(std::string_view json)
+{
+    matrix_parser p(json);
+    numa_characterization c;
+    if (!p.seek_key("nodes")) {
+        throw std::runtime_error("numa_characterization: missing \"nodes\"");
+    }
+    const double nodes = p.number();
+    if (nodes < 1 || nodes != static_cast<double>(static_cast<int>(nodes))) {
+        throw std::runtime_error("numa_characterization: \"nodes\" must be a positive integer");
+    }
+    c.nodes = static_cast<int>(nodes);
+
+    if (!p.seek_key("distance")) {
+        throw std::runtime_error("numa_characterization: missing \"distance\"");
+    }
+    c.distance = p.matrix<int>();
+    if (p.seek_key("latency_ns")) {
+        c.latency_ns = p.matrix<double>();
+    }
+    if (p.seek_key("bandwidth_gbps")) {
+        c.bandwidth_gbps = p.matrix<double>();
+    }
+
+    check_shape(c.distance, c.nodes, "distance", false);
+    check_shape(c.latency_ns, c.nodes, "latency_ns", true);
+    check_shape(c.bandwidth_gbps, c.nodes, "bandwidth_gbps", true);
+    return c;
+}
+
+numa_characterization load_numa_characterization(const std::string& path)
+{
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("numa_characterization: cannot open " + path);
+    }
+    std::ostringstream text;
+    text << in.rdbuf();
+    return numa_characterization_from_json(text.str());
+}
+
+void save_numa_characterization(const numa_characterization& c, const std::string& path)
+{
+    std::ofstream out(path, std::ios::trunc);
+    out << to_json(c);
+    if (!out) {
+        throw std::runtime_error("numa_characterization: cannot write " + path);
+    }
+}
+
+std::vector<int> nodes_by_proximity(const numa_characterization& c, int cpu_node)
+{
+    std::vector<int> order;
+    if (cpu_node < 0 || cpu_node >= c.nodes) {
+        return order;
+    }
+    // Negative distances mark node ids that are not present.
+    const auto row = static_cast<std::size_t>(cpu_node);
+    const auto& distance = c.distance[row];
+    for (int n = 0; n < c.nodes; ++n) {
+        if (distance[static_cast<std::size_t>(n)] >= 0) {
+            order.push_back(n);
+        }
+    }
+
+    // Pairs the tool could not measure hold 0 (or less); they rank after
+    // every measured node, by distance among themselves. A row with no
+    // measurements at all (e.g. a CPU-less node) is ordered by distance.
+    const std::vector<double>* latency = c.latency_ns.empty() ? nullptr : &c.latency_ns[row];
+    const auto measured = [&](int n) { return latency && (*latency)[static_cast<std::size_t>(n)] > 0.0; };
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        const bool ma = measured(a);
+        const bool mb = measured(b);
+        if (ma != mb) {
+            return ma;
+        }
+        if (ma) {
+            return (*latency)[static_cast<std::size_t>(a)] < (*latency)[static_cast<std::size_t>(b)];
+        }
+        return distance[static_cast<std::size_t>(a)] < distance[static_cast<std::size_t>(b)];
+    });
+    return order;
+}
+
+} // namespace hpc::support
@@ -0,0 +1,253 @@
+#include <hpc/core/tlsf_allocator.hpp>
+
+#include <bit>
+#include <new>
+#include <stdexcept>
+
+namespace hpc::core {
+
+// In-band block header. The payload starts right after `size`; while the
+// block is free its first 16 bytes hold the free-list links.
+struct tlsf_allocator::block {
+    block* prev_phys;  // valid only when the previous block is free
+    std::size_t size;  // payload bytes | flags
+    block* next_free;
+    block* prev_free;
+
+    static constexpr std::size_t free_bit = 1;
+    static constexpr std::size_t prev_free_bit = 2;
+    static constexpr std::size_t overhead = 2 * sizeof(void*);
+    static constexpr std::size_t min_payload = 2 * sizeof(void*);
+
+    std::size_t payload() const noexcept { return size & ~(free_bit | prev_free_bit); }
+    void set_payload(std::size_t bytes) noexcept { size = bytes | (size & (free_bit | prev_free_bit)); }
+
+    bool is_free() const noexcept { return size & free_bit; }
+    void set_free(bool f) noexcept { size = f ? size | free_bit : size & ~free_bit; }
+    bool is_prev_free() const noexcept { return size & prev_free_bit; }
+    void set_prev_free(bool f) noexcept { size = f ? size | prev_free_bit : size & ~prev_free_bit; }
+
+    std::byte* data() noexcept { return reinterpret_cast<std::byte*>(this) + overhead; }
+    block* next_phys() noexcept { return reinterpret_cast<block*>(data() + payload()); }
+
+    static block* from_data(void* p) noexcept
+    {
+        return reinterpret_cast<block*>(static_cast<std::byte*>(p) - overhead);
+    }
+};
+
+static_assert(tlsf_allocator::alignment == 2 * sizeof(void*), "header must preserve payload alignment");
+
+namespace {
+
+constexpr std::size_t align_up(std::size_t n, std::size_t a) noexcept { return (n + a - 1) & ~(a - 1); }
+
+} // namespace
+
+tlsf_allocator::tlsf_allocator(std::size_t capacity)
+{
+    region_ = hpc::support::huge_page_alloc(capacity);
+    if (!region_.ptr) {
+        throw std::bad_alloc();
+    }
+    init(region_.ptr, capacity);
+}
+
+tlsf_allocator::tlsf_allocator(void* buffer, std::size_t bytes)
+{
+    init(buffer, bytes);
+}
+
+tlsf_allocator::~tlsf_allocator()
+{
+    hpc::support::huge_page_free(region_);
+}
+
+void tlsf_allocator::init(void* buffer, std::size_t bytes)
+{
+    auto* begin = static_cast<std::byte*>(buffer);
+    auto* aligned = reinterpret_cast<std::byte*>(align_up(reinterpret_cast<std::uintptr_t>(begin), alignment));
+    const std::size_t skew = static_cast<std::size_t>(aligned - begin);
+    if (bytes < skew + 2 * block::overhead + block::min_payload) {
+        throw std::invalid_argument("tlsf_allocator: buffer too small");
+    }
+
+    // One free block spanning the buffer, then a zero-size used sentinel so
+    // next_phys() never runs off the end.
+    std::size_t payload = (bytes - skew - 2 * block::overhead) & ~(alignment - 1);
+    const std::size_t max_payload = (std::size_t{1} << fl_max_log2) - alignment;
+    if (payload > max_payload) {
+        payload = max_payload;
+    }
+    capacity_ = payload;
+
+    auto* b = reinterpret_cast<block*>(aligned);
+    b->prev_phys = nullptr;
+    b->size = payload;
+    b->set_free(true);
+
+    block* sentinel = b->next_phys();
+    sentinel->prev_phys = b;
+    sentinel->size = 0;
+    sentinel->set_prev_free(true);
+
+    insert(b);
+    free_bytes_ = payload;
+}
+
+void tlsf_allocator::mapping(std::size_t size, unsigned& fl, unsigned& sl) noexcept
+{
+    if (size < small_block) {
+        fl = 0;
+        sl = static_cast<unsigned>(size >> align_log2);
+        return;
+    }
+    const auto msb = static_cast<unsigned>(std::bit_width(size) - 1);
+    sl = static_cast<unsigned>(size >> (msb - sl_log2)) ^ sl_count;
+    fl = msb - fl_shift + 1;
+}
+
+tlsf_allocator::block* tlsf_allocator::find_suitable(unsigned& fl, unsigned& sl) const noexcept
+{
+    std::uint32_t sl_map = sl_bitmap_[fl] & (~std::uint32_t{0} << sl);
+    if (sl_map == 0) {
+        const std::uint64_t fl_map = fl + 1 < 64 ? fl_bitmap_ & (~std::uint64_t{0} << (fl + 1)) : 0;
+        if (fl_map == 0) {
+            return nullptr;
+        }
+        fl = static_cast<unsigned>(std::countr_zero(fl_map));
+        sl_map = sl_bitmap_[fl];
+    }
+    sl = static_cast<unsigned>(std::countr_zero(sl_map));
+    return free_lists_[fl][sl];
+}
+
+void tlsf_allocator::insert(block* b) noexcept
+{
+    unsigned fl = 0;
+    unsigned sl = 0;
+    mapping(b->payload(), fl, sl);
+    block* head = free_lists_[fl][sl];
+    b->next_free = head;
+    b->prev_free = nullptr;
+    if (head) {
+        head->prev_free = b;
+    }
+    free_lists_[fl][sl] = b;
+    fl_bitmap_ |= std::uint64_t{1} << fl;
+    sl_bitmap_[fl] |= std::uint32_t{1} << sl;
+}
+
+void tlsf_allocator::remove(block* b) noexcept
+{
+    unsigned fl = 0;
+    unsigned sl = 0;
+    mapping(b->payload(), fl, sl);
+    if (b->next_free) {
+        b->next_free->prev_free = b->prev_free;
+    }
+    if (b->prev_free) {
+        b->prev_free->next_free = b->next_free;
+        return;
+    }
+    free_lists_[fl][sl] = b->next_free;
+    if (!b->next_free) {
+        sl_bitmap_[fl] &= ~(std::uint32_t{1} << sl);
+        if (sl_bitmap_[fl] == 0) {
+            fl_bitmap_ &= ~(std::uint64_t{1} << fl);
+        }
+    }
+}
+
+void* tlsf_allocator::allocate(std::size_t bytes) noexcept
+{
+    if (bytes == 0 || bytes > capacity_) {
+        return nullptr;
+    }
+    std::size_t size = align_up(bytes < block::min_payload ? block::min_payload : bytes, alignment);
+
+    // Round up to the next size class so the head of its list always fits.
+    std::size_t search = size;
+    if (search >= small_block) {
+        search += (std::size_t{1} << (std::bit_width(search) - 1 - sl_log2)) - 1;
+    }
+    unsigned fl = 0;
+    unsigned sl = 0;
+    mapping(search, fl, sl);
+    if (fl >= fl_count) {
+        return nullptr;
+    }
+    block* b = find_suitable(fl, sl);
+    if (!b) {
+        return nullptr;
+    }
+    remove(b);
+
+    // Split off the tail if it can hold a block of its own.
+    if (b->payload() >= size + block::overhead + block::min_payload) {
+        auto* rest = reinterpret_cast<block*>(b->data() + size);
+        rest->size = b->payload() - size - block::overhead;
+        rest->set_free(true);
+        rest->prev_phys = b;
+        rest->next_phys()->prev_phys = rest;
+        b->set_payload(size);
+        insert(rest);
+        free_bytes_ -= block::overhead;
+    }
+
+    b->set_free(false);
+    b->next_phys()->set_prev_free(false);
+    free_bytes_ -= b->payload();
+    return b->data();
+}
+
+void tlsf_allocator::deallocate(void* p) noexcept
+{
+    if (!p) {
+        return;
+    }
+    block* b = block::from_data(p);
+    free_bytes_ += b->payload();
+    b->set_free(true);
+
+    if (b->is_prev_free()) {
+        block* prev = b->prev_phys;
+        remove(prev);
+        prev->set_payload(prev->payload() + block::overhead + b->payload());
+        free_bytes_ += block::overhead;
+        b = prev;
+    }
+    block* next = b->next_phys();
+    if (next->is_free()) {
+        remove(next);
+        b->set_payload(b->payload() + block::overhead + next->payload());
+        free_bytes_ += block::overhead;
+        next = b->next_phys();
+    }
+    next->prev_phys = b;
+    next->set_prev_free(true);
+    insert(b);
+}
+
+std::size_t tlsf_allocator::block_size(const void* p) const noexcept
+{
+    return block::from_data(const_cast<void*>(p))->payload();
+}
+
+std::size_t tlsf_allocator::largest_free_block() const noexcept
+{
+    if (fl_bitmap_ == 0) {
+        return 0;
+    }
+    const auto fl = static_cast<unsigned>(63 - std::countl_zero(fl_bitmap_));
+    const auto sl = static_cast<unsigned>(31 - std::countl_zero(sl_bitmap_[fl]));
+    std::size_t largest = 0;
+    for (const block* b = free_lists_[fl][sl]; b; b = b->next_free) {
+        if (b->payload() > largest) {
+            largest = b->payload();
+        }
+    }
+    return largest;
+}
+
+} // namespace hpc::core
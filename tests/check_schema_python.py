@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+"""Check the NumPy dtype generated from test_schema.json against the C++ layout.
+
+The expected offsets match tests/test_schema_codegen.cpp. Exits 77 (skipped)
+when NumPy is not installed.
+"""
+import sys
+
+try:
+    import numpy  # noqa: F401
+except ImportError:
+    print("numpy not available; skipping")
+    sys.exit(77)
+
+sys.path.insert(0, sys.argv[1])
+from test_schema import QUOTE_DTYPE, QUOTE_SIZE  # noqa: E402
+
+expected = {"instrument": 0, "side": 4, "price": 8, "qty": 16, "symbol": 20}
+offsets = {name: QUOTE_DTYPE.fields[name][1] for name in QUOTE_DTYPE.names}
+if offsets != expected:
+    sys.exit(f"offset mismatch: {offsets} != {expected}")
+if QUOTE_DTYPE.itemsize != 64 or QUOTE_SIZE != 64:
+    sys.exit(f"itemsize mismatch: {QUOTE_DTYPE.itemsize}, {QUOTE_SIZE}")
+print("ok")
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+
+#include <hpc/core/actor.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using hpc::core::actor_scheduler;
+using hpc::core::actor_scheduler_config;
+using hpc::core::basic_actor;
+
+namespace {
+
+class counter_actor : public basic_actor<std::uint64_t> {
+public:
+    counter_actor(actor_scheduler& s, std::size_t capacity) : basic_actor(s, capacity) {}
+
+    std::atomic<std::uint64_t> count{0};
+    std::atomic<std::uint64_t> sum{0};
+
+private:
+    void on_message(std::uint64_t& v) noexcept override
+    {
+        // Only one worker runs the actor at a time, so plain RMW is enough.
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        sum.store(sum.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    }
+};
+
+class ping_actor : public basic_actor<int> {
+public:
+    ping_actor(actor_scheduler& s) : basic_actor(s, 4) {}
+
+    ping_actor* peer{};
+    std::atomic<int> last{0};
+
+private:
+    void on_message(int& hops) noexcept override
+    {
+        last.store(hops, std::memory_order_relaxed);
+        if (hops > 0) {
+            peer->send(hops - 1);
+        }
+    }
+};
+
+class logging_actor : public basic_actor<int> {
+public:
+    logging_actor(actor_scheduler& s, std::vector<int>& log) : basic_actor(s, 256), log_(&log) {}
+
+private:
+    void on_message(int& v) noexcept override { log_->push_back(v); }
+
+    std::vector<int>* log_;
+};
+
+template <class Pred>
+bool wait_for(Pred pred)
+{
+    for (int i = 0; i < 20000 && !pred(); ++i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return pred();
+}
+
+} // namespace
+
+TEST(Actor, ManyProducersOneMailbox)
+{
+    actor_scheduler_config cfg;
+    cfg.worker_count = 2;
+    actor_scheduler sched(cfg);
+    auto& counter = sched.spawn<counter_actor>(64);
+    sched.start();
+
+    constexpr std::uint64_t kPerThread = 20000;
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 3; ++t) {
+        producers.emplace_back([&] {
+            for (std::uint64_t i = 1; i <= kPerThread; ++i) {
+                while (!counter.send(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+
+    EXPECT_TRUE(wait_for([&] { return counter.count.load() == 3 * kPerThread; }));
+    EXPECT_EQ(counter.sum.load(), 3 * kPerThread * (kPerThread + 1) / 2);
+    sched.stop();
+    EXPECT_EQ(sched.messages_processed(), 3 * kPerThread);
+}
+
+TEST(Actor, PingPongAcrossActors)
+{
+    actor_scheduler_config cfg;
+    cfg.worker_count = 2;
+    actor_scheduler sched(cfg);
+    auto& a = sched.spawn<ping_actor>();
+    auto& b = sched.spawn<ping_actor>();
+    a.peer = &b;
+    b.peer = &a;
+    sched.start();
+
+    ASSERT_TRUE(a.send(1001));
+    EXPECT_TRUE(wait_for([&] { return b.last.load() == 0; }));
+}
+
+TEST(Actor, BudgetInterleavesBusyActors)
+{
+    actor_scheduler_config cfg;
+    cfg.worker_count = 1;
+    cfg.budget = 8;
+    actor_scheduler sched(cfg);
+
+    std::vector<int> log; // one worker, so no synchronization needed
+    auto& busy = sched.spawn<logging_actor>(log);
+    auto& quiet = sched.spawn<logging_actor>(log);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(busy.send(i));
+    }
+    ASSERT_TRUE(quiet.send(-1));
+
+    sched.start();
+    EXPECT_TRUE(wait_for([&] { return sched.messages_processed() == 101; }));
+    sched.stop();
+
+    // The quiet actor runs after the busy one's first activation, not after
+    // all 100 of its messages.
+    ASSERT_EQ(log.size(), 101u);
+    EXPECT_EQ(log[8], -1);
+    EXPECT_GE(sched.activations(), 100u / 8);
+}
+
+TEST(Actor, SpawnRespectsLimit)
+{
+    actor_scheduler_config cfg;
+    cfg.max_actors = 2;
+    actor_scheduler sched(cfg);
+    sched.spawn<counter_actor>(8);
+    sched.spawn<counter_actor>(8);
+    EXPECT_THROW(sched.spawn<counter_actor>(8), std::bad_alloc);
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <hpc/core/backoff.hpp>
+
+#include <chrono>
+
+TEST(Backoff, PauseCostCalibrated)
+{
+    const double cost = hpc::core::pause_cost_ns();
+    EXPECT_GT(cost, 0.0);
+    EXPECT_LT(cost, 1000.0);
+    EXPECT_EQ(cost, hpc::core::pause_cost_ns()); // measured once
+}
+
+TEST(Backoff, SpinForTracksRequestedTime)
+{
+    constexpr std::uint64_t ns = 2'000'000;
+    const auto t0 = std::chrono::steady_clock::now();
+    hpc::core::spin_for_ns(ns);
+    const auto elapsed = std::chrono::steady_clock::now() - t0;
+    // Preemption only lengthens the spin; a calibration skewed by a noisy
+    // startup shortens it, so the lower bound is loose.
+    EXPECT_GE(elapsed, std::chrono::nanoseconds(ns / 4));
+}
+
+TEST(Backoff, ExponentialGivesUpAtCap)
+{
+    hpc::core::exponential_backoff b(10, 80);
+    int spins = 0;
+    while (b.pause()) {
+        ++spins;
+        ASSERT_LT(spins, 100);
+    }
+    EXPECT_EQ(spins, 4); // 10, 20, 40, 80
+    EXPECT_FALSE(b.pause());
+
+    b.reset();
+    EXPECT_TRUE(b.pause());
+}
+
+TEST(Backoff, ProportionalSpendsBudget)
+{
+    hpc::core::proportional_backoff b(100, 1000, 3000);
+    EXPECT_TRUE(b.pause(50)); // capped at 1000
+    EXPECT_TRUE(b.pause(5));  // 500
+    EXPECT_TRUE(b.pause(0));  // 100: zero distance still waits one unit
+    EXPECT_TRUE(b.pause(20)); // 1000 -> 2600 spent
+    EXPECT_TRUE(b.pause(10)); // 1000 -> 3600 spent
+    EXPECT_FALSE(b.pause(1));
+
+    b.reset();
+    EXPECT_TRUE(b.pause(1));
+}
+
+TEST(Backoff, RandomizedStaysBounded)
+{
+    hpc::core::randomized_backoff b(10, 1000);
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100; ++i) {
+        b.pause();
+    }
+    // 100 pauses of at most 1 us each, with generous slack for preemption.
+    EXPECT_LT(std::chrono::steady_clock::now() - t0, std::chrono::milliseconds(500));
+}
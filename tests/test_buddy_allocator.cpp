@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <hpc/core/buddy_allocator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+using hpc::core::buddy_allocator;
+
+TEST(BuddyAllocator, SplitAndCoalesce)
+{
+    buddy_allocator buddy(std::size_t{1} << 20, 4096, std::size_t{1} << 20);
+    EXPECT_EQ(buddy.capacity(), std::size_t{1} << 20);
+    EXPECT_EQ(buddy.max_block(), std::size_t{1} << 20);
+
+    void* a = buddy.allocate(100);
+    void* b = buddy.allocate(4096);
+    void* c = buddy.allocate(5000);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(buddy.block_size(a), 4096u);
+    EXPECT_EQ(buddy.block_size(c), 8192u);
+    EXPECT_EQ(static_cast<std::byte*>(b) - static_cast<std::byte*>(a), 4096);
+    EXPECT_EQ(buddy.free_bytes(), (std::size_t{1} << 20) - 16384);
+
+    auto s = buddy.stats();
+    EXPECT_EQ(s.allocations, 3u);
+    EXPECT_GT(s.external_fragmentation, 0.0);
+
+    buddy.deallocate(b);
+    buddy.deallocate(a);
+    buddy.deallocate(c);
+    s = buddy.stats();
+    EXPECT_EQ(s.free_bytes, buddy.capacity());
+    EXPECT_EQ(s.largest_free_block, buddy.capacity());
+    EXPECT_EQ(s.external_fragmentation, 0.0);
+    EXPECT_EQ(s.free_blocks_per_order.back(), 1u);
+}
+
+TEST(BuddyAllocator, ExhaustionAndOversize)
+{
+    buddy_allocator buddy(std::size_t{64} << 10, 4096, std::size_t{16} << 10);
+    EXPECT_EQ(buddy.allocate(std::size_t{32} << 10), nullptr); // above max_block
+
+    std::vector<void*> blocks;
+    while (void* p = buddy.allocate(std::size_t{16} << 10)) {
+        blocks.push_back(p);
+    }
+    EXPECT_EQ(blocks.size(), 4u);
+    EXPECT_EQ(buddy.allocate(1), nullptr);
+
+    buddy.deallocate(blocks[2]);
+    EXPECT_EQ(buddy.stats().largest_free_block, std::size_t{16} << 10);
+    void* p = buddy.allocate(1);
+    EXPECT_EQ(p, blocks[2]);
+}
+
+TEST(BuddyAllocator, RandomizedNoOverlap)
+{
+    buddy_allocator buddy(std::size_t{8} << 20, 4096, std::size_t{1} << 20);
+    std::mt19937 rng(42);
+    std::vector<std::pair<std::byte*, std::size_t>> live;
+
+    for (int step = 0; step < 20000; ++step) {
+        if (!live.empty() && (rng() % 2 == 0 || live.size() > 200)) {
+            const std::size_t i = rng() % live.size();
+            buddy.deallocate(live[i].first);
+            live[i] = live.back();
+            live.pop_back();
+            continue;
+        }
+        const std::size_t bytes = std::size_t{1} + rng() % (std::size_t{256} << 10);
+        auto* p = static_cast<std::byte*>(buddy.allocate(bytes));
+        if (!p) {
+            continue;
+        }
+        ASSERT_GE(buddy.block_size(p), bytes);
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(p) % 4096, 0u);
+        live.emplace_back(p, buddy.block_size(p));
+    }
+
+    std::sort(live.begin(), live.end());
+    for (std::size_t i = 1; i < live.size(); ++i) {
+        ASSERT_LE(live[i - 1].first + live[i - 1].second, live[i].first);
+    }
+    for (auto& [p, size] : live) {
+        buddy.deallocate(p);
+    }
+    EXPECT_EQ(buddy.stats().largest_free_block, std::size_t{1} << 20);
+    EXPECT_EQ(buddy.free_bytes(), buddy.capacity());
+}
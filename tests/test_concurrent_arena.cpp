@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <hpc/core/concurrent_arena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using hpc::core::concurrent_arena;
+
+TEST(ConcurrentArena, ThreadsCarveDisjointChunks)
+{
+    constexpr int kThreads = 4;
+    constexpr int kAllocs = 2000;
+    concurrent_arena arena(std::size_t{16} << 20, std::size_t{64} << 10);
+
+    std::vector<std::vector<std::pair<std::uintptr_t, std::size_t>>> blocks(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            concurrent_arena::thread_cache cache(arena);
+            for (int i = 0; i < kAllocs; ++i) {
+                const std::size_t bytes = 8 + static_cast<std::size_t>(i % 200);
+                const std::size_t align = std::size_t{1} << (i % 7);
+                void* p = cache.allocate(bytes, align);
+                ASSERT_NE(p, nullptr);
+                ASSERT_EQ(reinterpret_cast<std::uintptr_t>(p) % align, 0u);
+                blocks[static_cast<std::size_t>(t)].emplace_back(reinterpret_cast<std::uintptr_t>(p), bytes);
+            }
+            // One oversized request is carved on its own.
+            void* big = cache.allocate(std::size_t{48} << 10, 64);
+            ASSERT_NE(big, nullptr);
+            blocks[static_cast<std::size_t>(t)].emplace_back(reinterpret_cast<std::uintptr_t>(big), std::size_t{48} << 10);
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    std::vector<std::pair<std::uintptr_t, std::size_t>> all;
+    for (auto& b : blocks) {
+        all.insert(all.end(), b.begin(), b.end());
+    }
+    std::sort(all.begin(), all.end());
+    for (std::size_t i = 1; i < all.size(); ++i) {
+        ASSERT_LE(all[i - 1].first + all[i - 1].second, all[i].first);
+    }
+    EXPECT_GT(arena.used(), 0u);
+    EXPECT_LE(arena.used(), arena.capacity());
+}
+
+TEST(ConcurrentArena, ResetInvalidatesThreadCaches)
+{
+    concurrent_arena arena(std::size_t{1} << 20, std::size_t{64} << 10);
+    concurrent_arena::thread_cache cache(arena);
+
+    void* first = cache.allocate(100);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(arena.used(), arena.chunk_size());
+
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0u);
+    // The stale chunk is dropped and the arena starts over.
+    EXPECT_EQ(cache.allocate(100), first);
+}
+
+TEST(ConcurrentArena, ZeroByteAllocationIsNotNull)
+{
+    concurrent_arena arena(std::size_t{1} << 20, std::size_t{64} << 10);
+    concurrent_arena::thread_cache cache(arena);
+
+    // A fresh cache has no chunk; this must not hand out the empty cursor.
+    EXPECT_NE(cache.allocate(0), nullptr);
+    arena.reset();
+    EXPECT_NE(cache.allocate(0, 1), nullptr);
+}
+
+TEST(ConcurrentArena, ExhaustionReturnsNull)
+{
+    concurrent_arena arena(std::size_t{256} << 10, std::size_t{64} << 10);
+    concurrent_arena::thread_cache cache(arena);
+    std::size_t count = 0;
+    while (cache.allocate(1024)) {
+        ++count;
+    }
+    EXPECT_EQ(count, 256u);
+    EXPECT_EQ(arena.used(), arena.capacity());
+}
+
+TEST(ConcurrentArena, CapacityBelowChunkSize)
+{
+    // Smaller than one default chunk: the thread takes the whole arena.
+    concurrent_arena arena(std::size_t{64} << 10);
+    concurrent_arena::thread_cache cache(arena);
+    EXPECT_NE(cache.allocate(64), nullptr);
+    std::size_t count = 1;
+    while (cache.allocate(1024)) {
+        ++count;
+    }
+    EXPECT_EQ(count, 64u); // 64 bytes + 63 KiB, then the last KiB is short
+}
+
+TEST(ConcurrentArena, TailSmallerThanChunkIsUsed)
+{
+    concurrent_arena arena(std::size_t{356} << 10); // 256 KiB chunk + 100 KiB tail
+    concurrent_arena::thread_cache cache(arena);
+    std::size_t count = 0;
+    while (cache.allocate(1024)) {
+        ++count;
+    }
+    EXPECT_EQ(count, 356u);
+    EXPECT_EQ(arena.used(), arena.capacity());
+}
+
+TEST(ConcurrentArena, NumaSegments)
+{
+    const int nodes[] = {0, 0};
+    concurrent_arena arena(std::size_t{1} << 20, std::size_t{64} << 10, nodes);
+    EXPECT_EQ(arena.segment_count(), 2u);
+
+    concurrent_arena::thread_cache cache(arena, 0);
+    std::size_t count = 0;
+    while (cache.allocate(std::size_t{16} << 10)) {
+        ++count;
+    }
+    // Falls back to the second segment once the first is full.
+    EXPECT_EQ(count, 64u);
+}
+
+TEST(ConcurrentArena, NumaSegmentsSmallerThanChunk)
+{
+    const int nodes[] = {0, 0};
+    // 96 KiB per node with the default 256 KiB chunk.
+    concurrent_arena arena(std::size_t{192} << 10, concurrent_arena::default_chunk_size, nodes);
+    concurrent_arena::thread_cache cache(arena, 0);
+    std::size_t count = 0;
+    while (cache.allocate(std::size_t{16} << 10)) {
+        ++count;
+    }
+    EXPECT_EQ(count, 12u);
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <hpc/core/frame_arena.hpp>
+
+#include <cstdint>
+
+using hpc::core::frame_arena;
+
+namespace {
+
+struct quote {
+    std::uint64_t id;
+    double price;
+};
+
+} // namespace
+
+TEST(FrameArena, PreviousFrameSurvivesOneTick)
+{
+    frame_arena frames(4096, 2);
+    EXPECT_EQ(frames.frame_count(), 2u);
+
+    quote* a = frames.create<quote>(quote{1, 10.0});
+    ASSERT_NE(a, nullptr);
+
+    frames.advance_frame();
+    quote* b = frames.create<quote>(quote{2, 20.0});
+    ASSERT_NE(b, nullptr);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(a->id, 1u); // last tick's data is still intact
+    EXPECT_EQ(a->price, 10.0);
+
+    // Two ticks later frame 0 is recycled from the start.
+    frames.advance_frame();
+    EXPECT_EQ(frames.used(), 0u);
+    EXPECT_EQ(frames.create<quote>(quote{3, 30.0}), a);
+    EXPECT_EQ(b->id, 2u);
+    EXPECT_EQ(frames.tick(), 2u);
+}
+
+TEST(FrameArena, FramesAreDisjointAndBounded)
+{
+    frame_arena frames(1024, 3);
+    std::uintptr_t starts[3];
+    for (auto& s : starts) {
+        s = reinterpret_cast<std::uintptr_t>(frames.allocate(1, 1));
+        std::size_t n = 1;
+        while (frames.allocate(64, 1)) {
+            ++n;
+        }
+        EXPECT_EQ(n, 1u + (1024 - 1) / 64);
+        frames.advance_frame();
+    }
+    EXPECT_EQ(starts[1] - starts[0], 1024u);
+    EXPECT_EQ(starts[2] - starts[1], 1024u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(frames.allocate(1, 1)), starts[0]);
+}
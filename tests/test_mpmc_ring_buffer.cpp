@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <atomic>
+#include <stdexcept>
 #include <thread>
 #include <unordered_set>
 #include <vector>
@@ -9,6 +10,56 @@
 
 namespace {
 
+// Counts live objects; move assignment throws when moves_left hits zero.
+struct throwing_move {
+    static inline int live = 0;
+    static inline int moves_left = -1;
+
+    int value = 0;
+
+    throwing_move(int v = 0) : value(v) { ++live; }
+    throwing_move(const throwing_move& other) : value(other.value) { ++live; }
+    ~throwing_move() { --live; }
+
+    throwing_move& operator=(throwing_move&& other)
+    {
+        if (moves_left-- == 0) throw std::runtime_error("move");
+        value = other.value;
+        return *this;
+    }
+};
+
+TEST(MPMCRingBufferBasic, BatchPopSurvivesThrowingMove)
+{
+    {
+        hpc::core::mpmc_ring_buffer<throwing_move> q(4);
+        for (int i = 1; i <= 4; ++i) {
+            ASSERT_TRUE(q.try_push(throwing_move{i}));
+        }
+        throwing_move dst[4];
+        throwing_move::moves_left = 1;
+        EXPECT_THROW(q.try_pop_batch(dst, 4), std::runtime_error);
+        throwing_move::moves_left = -1;
+        EXPECT_EQ(dst[0].value, 1);
+
+        // Element 2 was claimed when its move threw and is dropped; the ring
+        // is not wedged: the rest pops in order and it refills.
+        throwing_move out;
+        for (int i = 3; i <= 4; ++i) {
+            ASSERT_TRUE(q.try_pop(out));
+            EXPECT_EQ(out.value, i);
+        }
+        for (int i = 5; i <= 8; ++i) {
+            EXPECT_TRUE(q.try_push(throwing_move{i}));
+        }
+        for (int i = 5; i <= 8; ++i) {
+            ASSERT_TRUE(q.try_pop(out));
+            EXPECT_EQ(out.value, i);
+        }
+    }
+    EXPECT_EQ(throwing_move::live, 0);
+}
+
 TEST(MPMCRingBufferBasic, SingleThreadPushPop)
 {
     hpc::core::mpmc_ring_buffer<int> q(8);
@@ -48,6 +99,24 @@ TEST(MPMCRingBufferBasic, BatchInterfaces)
     }
 }
 
+TEST(MPMCRingBufferBasic, DrainAndStreamingPush)
+{
+    hpc::core::mpmc_ring_buffer<std::uint64_t> q(32);
+
+    std::uint64_t expected = 0;
+    std::uint64_t next = 0;
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 20; ++i) {
+            EXPECT_TRUE(q.try_push_streaming(next++));
+        }
+        std::size_t drained = q.drain([&](std::uint64_t& v) noexcept { EXPECT_EQ(v, expected++); }, 7, 3);
+        EXPECT_EQ(drained, 7u);
+        drained = q.drain([&](std::uint64_t& v) noexcept { EXPECT_EQ(v, expected++); });
+        EXPECT_EQ(drained, 13u);
+        EXPECT_TRUE(q.empty());
+    }
+}
+
 TEST(MPMCRingBufferConcurrency, MultiProducerMultiConsumer)
 {
     constexpr std::size_t kCapacity = 1 << 10;
@@ -130,4 +199,43 @@ TEST(MPMCRingBufferConcurrency, MultiProducerMultiConsumer)
     EXPECT_EQ(seen.size(), total);
 }
 
+TEST(MPMCRingBufferConcurrency, BatchDrainConsumers)
+{
+    constexpr std::size_t kProducers = 2;
+    constexpr std::size_t kConsumers = 2;
+    constexpr std::size_t kPerProducer = 20000;
+    constexpr std::size_t kTotal = kProducers * kPerProducer;
+
+    hpc::core::mpmc_ring_buffer<std::size_t> q(256);
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::vector<std::size_t>> consumer_data(kConsumers);
+
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (std::size_t i = 0; i < kPerProducer; ++i) {
+                while (!q.try_push(p * kPerProducer + i)) {
+                }
+            }
+        });
+    }
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&, c]() {
+            while (consumed.load(std::memory_order_relaxed) < kTotal) {
+                std::size_t n = q.drain([&](std::size_t& v) noexcept { consumer_data[c].push_back(v); }, 32);
+                consumed.fetch_add(n, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    std::unordered_set<std::size_t> seen;
+    for (const auto& vec : consumer_data) {
+        for (auto v : vec) {
+            EXPECT_TRUE(seen.insert(v).second);
+        }
+    }
+    EXPECT_EQ(seen.size(), kTotal);
+}
+
 } // namespace
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <hpc/ipc/notifying_ring.hpp>
+
+namespace {
+
+// Number of ready descriptors after a zero-timeout epoll_wait.
+int ready(int epoll_fd)
+{
+    epoll_event ev{};
+    return ::epoll_wait(epoll_fd, &ev, 1, 0);
+}
+
+TEST(NotifyingRing, SignalsOnlyOnTransition)
+{
+    hpc::ipc::notifying_spsc_ring<int> q(64);
+    const int ep = hpc::ipc::create_epoll();
+    hpc::ipc::epoll_add(ep, q.fd(), 7);
+
+    EXPECT_EQ(ready(ep), 0);
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(q.try_push(i));
+    }
+    EXPECT_EQ(q.wakeups(), 1u);
+    EXPECT_EQ(ready(ep), 1);
+
+    int expected = 0;
+    EXPECT_EQ(q.service([&](int& v) { EXPECT_EQ(v, expected++); }), 10u);
+    EXPECT_EQ(ready(ep), 0);
+
+    const int batch[] = {10, 11, 12};
+    EXPECT_EQ(q.try_push_batch(batch, 3), 3u);
+    EXPECT_EQ(q.wakeups(), 2u);
+    EXPECT_EQ(q.service([&](int& v) { EXPECT_EQ(v, expected++); }), 3u);
+
+    ::close(ep);
+}
+
+TEST(NotifyingRing, BudgetKeepsDescriptorReadable)
+{
+    hpc::ipc::notifying_spsc_ring<int> q(64);
+    const int ep = hpc::ipc::create_epoll();
+    hpc::ipc::epoll_add(ep, q.fd(), 0);
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(q.try_push(i));
+    }
+    EXPECT_EQ(q.service([](int&) {}, 4), 4u);
+    EXPECT_EQ(ready(ep), 1);
+    EXPECT_EQ(q.service([](int&) {}, 4), 4u);
+    EXPECT_EQ(q.service([](int&) {}, 4), 2u);
+    EXPECT_EQ(ready(ep), 0);
+    EXPECT_EQ(q.wakeups(), 1u);
+
+    ::close(ep);
+}
+
+TEST(NotifyingRing, EpollConsumerNeverMissesWakeup)
+{
+    constexpr std::uint64_t kCount = 100000;
+    hpc::ipc::notifying_spsc_ring<std::uint64_t> q(256);
+    const int ep = hpc::ipc::create_epoll();
+    hpc::ipc::epoll_add(ep, q.fd(), 1);
+
+    std::thread producer([&]() {
+        for (std::uint64_t i = 0; i < kCount; ++i) {
+            while (!q.try_push(i)) {
+                std::this_thread::yield();
+            }
+            if (i % 1000 == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::uint64_t expected = 0;
+    while (expected < kCount) {
+        epoll_event ev{};
+        // A lost wakeup would leave the consumer blocked here until timeout.
+        const int n = ::epoll_wait(ep, &ev, 1, 5000);
+        ASSERT_EQ(n, 1) << "consumer stalled at " << expected;
+        EXPECT_EQ(ev.data.u64, 1u);
+        q.service([&](std::uint64_t& v) {
+            EXPECT_EQ(v, expected);
+            ++expected;
+        }, 64);
+    }
+    producer.join();
+    EXPECT_LE(q.wakeups(), kCount);
+
+    ::close(ep);
+}
+
+} // namespace
@@ -1,10 +1,34 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
 #include <hpc/core/numa_arena.hpp>
 #include <hpc/core/numa_pool.hpp>
+#include <hpc/core/numa_ring_buffer.hpp>
+#include <hpc/support/cpu_topology.hpp>
+#include <hpc/support/numa_characterization.hpp>
 
 namespace {
 
+std::size_t page_size() noexcept
+{
+#if defined(__linux__)
+    const long ps = ::sysconf(_SC_PAGESIZE);
+    return static_cast<std::size_t>(ps > 0 ? ps : 4096);
+#else
+    return 4096;
+#endif
+}
+
 TEST(NumaArena, BasicAllocateReset)
 {
     constexpr std::size_t kSize = 1 << 16;
@@ -23,6 +47,118 @@ TEST(NumaArena, BasicAllocateReset)
     EXPECT_NE(p3, nullptr);
 }
 
+TEST(NumaArena, PolicyAppliedBeforeFirstTouch)
+{
+    constexpr std::size_t kSize = 1 << 20;
+    const int node0[] = {0};
+
+    for (auto policy : {hpc::core::numa_policy::bind, hpc::core::numa_policy::preferred,
+                        hpc::core::numa_policy::interleave, hpc::core::numa_policy::local}) {
+        hpc::core::numa_arena arena{kSize, policy, node0};
+        EXPECT_EQ(arena.policy(), policy);
+
+        // Nothing is touched until the caller writes.
+        auto before = arena.verify_placement();
+        EXPECT_GE(before.pages_total * page_size(), kSize);
+        EXPECT_EQ(before.pages_not_present, before.pages_total);
+
+        auto* p = static_cast<unsigned char*>(arena.allocate(kSize, 64));
+        ASSERT_NE(p, nullptr);
+        std::memset(p, 1, kSize);
+
+        auto after = arena.verify_placement();
+        std::size_t placed = 0;
+        for (std::size_t pages : after.pages_per_node) {
+            placed += pages;
+        }
+        EXPECT_EQ(placed + after.pages_not_present, after.pages_total);
+        if (arena.policy_applied()) {
+            // Only bind and preferred name node 0 as the target; local
+            // follows the touching thread, which may run on another node.
+            if (policy == hpc::core::numa_policy::bind || policy == hpc::core::numa_policy::preferred) {
+                ASSERT_FALSE(after.pages_per_node.empty());
+                EXPECT_EQ(after.pages_per_node[0], after.pages_total);
+                EXPECT_EQ(arena.node(), 0);
+            } else {
+                EXPECT_EQ(arena.node(), -1);
+            }
+        }
+    }
+}
+
+TEST(NumaArena, PreferredUsesFirstGivenNode)
+{
+    const auto online = hpc::support::online_numa_nodes();
+    if (online.size() < 2) {
+        GTEST_SKIP() << "needs two NUMA nodes";
+    }
+    // Listed highest first: the kernel would prefer the lowest id if both
+    // were in the mask.
+    const int nodes[] = {online.back(), online.front()};
+    constexpr std::size_t kSize = 1 << 20;
+    hpc::core::numa_arena arena{kSize, hpc::core::numa_policy::preferred, nodes};
+    if (!arena.policy_applied()) {
+        GTEST_SKIP() << "NUMA policy not applied";
+    }
+    EXPECT_EQ(arena.node(), online.back());
+
+    std::memset(arena.allocate(kSize, 64), 1, kSize);
+    const auto placement = arena.verify_placement();
+    ASSERT_GT(placement.pages_per_node.size(), static_cast<std::size_t>(online.back()));
+    EXPECT_EQ(placement.pages_per_node[static_cast<std::size_t>(online.back())], placement.pages_total);
+}
+
+TEST(NumaArena, MigrateToNode)
+{
+    constexpr std::size_t kSize = 1 << 20;
+    hpc::core::numa_arena arena{kSize, -1};
+    std::memset(arena.allocate(kSize, 64), 1, kSize);
+
+    auto result = arena.migrate_to_node(0, 64 << 10);
+    if (!result.ok) {
+        GTEST_SKIP() << "NUMA not available";
+    }
+    // On a single-node machine everything is already on node 0.
+    EXPECT_EQ(result.pages_failed, 0u);
+    EXPECT_EQ(arena.node(), 0);
+    EXPECT_EQ(arena.policy(), hpc::core::numa_policy::bind);
+    EXPECT_GE(result.elapsed.count(), 0);
+
+    auto placement = arena.verify_placement();
+    EXPECT_EQ(placement.pages_per_node[0], placement.pages_total);
+
+    // Background variant; pages faulted afterwards follow the new binding.
+    auto async_result = arena.migrate_to_node_async(0).get();
+    EXPECT_TRUE(async_result.ok);
+    EXPECT_EQ(async_result.bytes_moved, 0u);
+}
+
+TEST(NumaPool, BlocksLiveInArenaAndMigrate)
+{
+    struct Item { char c[12]; };
+    hpc::core::numa_pool<Item> pool{256, -1};
+    Item* first = pool.allocate();
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % alignof(void*), 0u);
+
+    auto placement = pool.verify_placement();
+    EXPECT_GT(placement.pages_total, 0u);
+    auto result = pool.migrate_to_node(0);
+    if (result.ok) {
+        EXPECT_EQ(pool.node(), 0);
+    }
+    pool.deallocate(first);
+}
+
+#if defined(__linux__)
+TEST(NumaPool, ThrowsWhenArenaCannotBeMapped)
+{
+    struct Item { char c[16]; };
+    // 2^60 bytes: more than any address space can map.
+    EXPECT_THROW((hpc::core::numa_pool<Item>{std::size_t{1} << 56, -1}), std::bad_alloc);
+}
+#endif
+
 TEST(NumaPool, BasicAllocateDeallocate)
 {
     struct Node { int x; int y; };
@@ -49,5 +185,133 @@ TEST(NumaPool, BasicAllocateDeallocate)
     }
 }
 
-} // namespace
+TEST(NumaTopology, NodesAndCores)
+{
+    const int nodes = hpc::support::numa_node_count();
+    EXPECT_GE(nodes, 1);
+#if defined(__linux__)
+    EXPECT_FALSE(hpc::support::cores_of_node(0).empty());
+#endif
+    EXPECT_TRUE(hpc::support::cores_of_node(nodes).empty());
+
+    const auto online = hpc::support::online_numa_nodes();
+    ASSERT_FALSE(online.empty());
+    EXPECT_TRUE(std::is_sorted(online.begin(), online.end()));
+    EXPECT_EQ(online.back() + 1, nodes);
+}
+
+TEST(NumaTopology, DistanceMatrix)
+{
+    const auto distance = hpc::support::numa_distance_matrix();
+    ASSERT_EQ(distance.size(), static_cast<std::size_t>(hpc::support::numa_node_count()));
+    for (std::size_t i = 0; i < distance.size(); ++i) {
+        ASSERT_EQ(distance[i].size(), distance.size());
+    }
+    for (int node : hpc::support::online_numa_nodes()) {
+        EXPECT_EQ(distance[static_cast<std::size_t>(node)][static_cast<std::size_t>(node)], 10);
+    }
+}
+
+TEST(NumaCharacterization, JsonRoundTripAndProximity)
+{
+    hpc::support::numa_characterization c;
+    c.nodes = 3;
+    c.distance = {{10, 21, 31}, {21, 10, 21}, {31, 21, 10}};
+    c.latency_ns = {{90.5, 150.0, 140.0}, {150.0, 91.0, 148.0}, {200.0, 140.0, 92.0}};
+    c.bandwidth_gbps = {{12.0, 7.5, 6.0}, {7.5, 12.5, 7.0}, {5.5, 7.0, 11.0}};
+
+    const auto back = hpc::support::numa_characterization_from_json(hpc::support::to_json(c));
+    EXPECT_EQ(back.nodes, 3);
+    EXPECT_EQ(back.distance, c.distance);
+    EXPECT_EQ(back.latency_ns, c.latency_ns);
+    EXPECT_EQ(back.bandwidth_gbps, c.bandwidth_gbps);
+    EXPECT_TRUE(back.has_measurements());
+
+    // Measured latency wins over distance (node 0 reaches node 2 faster than
+    // node 1 despite the larger SLIT distance).
+    EXPECT_EQ(hpc::support::nodes_by_proximity(back, 0), (std::vector<int>{0, 2, 1}));
+    EXPECT_TRUE(hpc::support::nodes_by_proximity(back, 3).empty());
+
+    // Unmeasured pairs (0) rank last, not first; an unmeasured row falls
+    // back to distance.
+    auto partial = back;
+    partial.latency_ns[0][1] = 0.0;
+    partial.latency_ns[1] = {0.0, 0.0, 0.0};
+    EXPECT_EQ(hpc::support::nodes_by_proximity(partial, 0), (std::vector<int>{0, 2, 1}));
+    partial.latency_ns[0][2] = 0.0;
+    EXPECT_EQ(hpc::support::nodes_by_proximity(partial, 0), (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(hpc::support::nodes_by_proximity(partial, 1), (std::vector<int>{1, 0, 2}));
+
+    // Sparse ids: node 1 is not online.
+    const auto sparse = hpc::support::numa_characterization_from_json(
+        R"({"nodes": 3, "distance": [[10, -1, 20], [-1, -1, -1], [20, -1, 10]]})");
+    EXPECT_EQ(hpc::support::nodes_by_proximity(sparse, 2), (std::vector<int>{2, 0}));
 
+    const auto distance_only = hpc::support::numa_characterization_from_json(
+        R"({"nodes": 2, "distance": [[10, 20], [20, 10]]})");
+    EXPECT_FALSE(distance_only.has_measurements());
+    EXPECT_EQ(hpc::support::nodes_by_proximity(distance_only, 1), (std::vector<int>{1, 0}));
+
+    EXPECT_THROW(hpc::support::numa_characterization_from_json(R"({"nodes": 2, "distance": [[10]]})"),
+                 std::runtime_error);
+    EXPECT_THROW(hpc::support::numa_characterization_from_json("{}"), std::runtime_error);
+}
+
+TEST(NumaCharacterization, FromTopology)
+{
+    const auto c = hpc::support::numa_characterization_from_topology();
+    EXPECT_EQ(c.nodes, hpc::support::numa_node_count());
+    EXPECT_FALSE(c.has_measurements());
+    const auto order = hpc::support::nodes_by_proximity(c, 0);
+    ASSERT_FALSE(order.empty());
+    EXPECT_EQ(order.front(), 0);
+}
+
+TEST(NumaHomedRing, SpscPushPopOnNode)
+{
+    hpc::core::numa_spsc_ring_buffer<int> q(63, 0);
+    EXPECT_TRUE(q.numa_node() == 0 || q.numa_node() == -1);
+    EXPECT_EQ(q.capacity(), 63u);
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 63; ++i) {
+            ASSERT_TRUE(q.try_push(i));
+        }
+        EXPECT_TRUE(q.full());
+        int value = -1;
+        for (int i = 0; i < 63; ++i) {
+            ASSERT_TRUE(q.try_pop(value));
+            EXPECT_EQ(value, i);
+        }
+        EXPECT_TRUE(q.empty());
+    }
+}
+
+TEST(NumaHomedRing, MpmcPushPopOnNode)
+{
+    hpc::core::numa_mpmc_ring_buffer<int> q(64, 0);
+    EXPECT_TRUE(q.numa_node() == 0 || q.numa_node() == -1);
+
+    for (int i = 0; i < 64; ++i) {
+        ASSERT_TRUE(q.try_push(i));
+    }
+    EXPECT_FALSE(q.try_push(64));
+    int value = -1;
+    for (int i = 0; i < 64; ++i) {
+        ASSERT_TRUE(q.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(NumaHomedRing, UnboundNode)
+{
+    hpc::core::numa_spsc_ring_buffer<int> q(8, -1);
+    EXPECT_EQ(q.numa_node(), -1);
+    EXPECT_TRUE(q.try_push(1));
+    int value = 0;
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, 1);
+}
+
+} // namespace
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <hpc/ipc/offset_ptr.hpp>
+#include <hpc/ipc/shm_hash_map.hpp>
+#include <hpc/ipc/shm_heap.hpp>
+#include <hpc/ipc/shm_vector.hpp>
+
+namespace {
+
+struct node {
+    int value;
+    hpc::ipc::offset_ptr<node> next;
+};
+
+TEST(OffsetPtr, NullAndCopySemantics)
+{
+    hpc::ipc::offset_ptr<int> p;
+    EXPECT_FALSE(p);
+    EXPECT_EQ(p.get(), nullptr);
+    EXPECT_TRUE(p == nullptr);
+
+    int values[4] = {1, 2, 3, 4};
+    hpc::ipc::offset_ptr<int> q = values;
+    EXPECT_EQ(*q, 1);
+    EXPECT_EQ(q[3], 4);
+    ++q;
+    EXPECT_EQ(q.get(), values + 1);
+
+    hpc::ipc::offset_ptr<int> r = q; // copy recomputes the offset
+    EXPECT_EQ(r.get(), values + 1);
+    EXPECT_TRUE(r == q);
+}
+
+TEST(OffsetPtr, SurvivesRelocation)
+{
+    // Copy a self-contained linked list byte-for-byte to another address;
+    // offset_ptrs keep pointing within the copy.
+    alignas(node) unsigned char a[3 * sizeof(node)];
+    auto* nodes = reinterpret_cast<node*>(a);
+    for (int i = 0; i < 3; ++i) {
+        ::new (&nodes[i]) node{i * 10, nullptr};
+    }
+    nodes[0].next = &nodes[1];
+    nodes[1].next = &nodes[2];
+
+    alignas(node) unsigned char b[sizeof(a)];
+    std::memcpy(b, a, sizeof(a));
+    auto* moved = reinterpret_cast<node*>(b);
+
+    int sum = 0;
+    for (node* n = moved; n; n = n->next.get()) {
+        EXPECT_GE(reinterpret_cast<unsigned char*>(n), b);
+        EXPECT_LT(reinterpret_cast<unsigned char*>(n), b + sizeof(b));
+        sum += n->value;
+    }
+    EXPECT_EQ(sum, 30);
+}
+
+struct index_root {
+    explicit index_root(hpc::ipc::shm_heap& heap) : prices(heap), by_id(heap) {}
+
+    hpc::ipc::shm_vector<std::uint64_t> prices;
+    hpc::ipc::shm_hash_map<std::uint64_t, std::uint64_t> by_id;
+};
+
+TEST(ShmContainers, SharedAcrossMappings)
+{
+    const std::string name = "/hpc_test_offset_ptr_" + std::to_string(::getpid());
+
+    hpc::ipc::shm_region writer({name, 1 << 20, true});
+    hpc::ipc::shm_region reader({name, 1 << 20, false});
+    ASSERT_NE(writer.address(), reader.address());
+
+    auto* heap = hpc::ipc::shm_heap::create(writer);
+    ASSERT_NE(heap, nullptr);
+    auto* root = heap->construct<index_root>(*heap);
+    ASSERT_NE(root, nullptr);
+    heap->set_root(root);
+
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(root->prices.push_back(i * 3));
+        ASSERT_TRUE(root->by_id.insert_or_assign(i * 7, i));
+    }
+    for (std::uint64_t i = 0; i < 1000; i += 2) {
+        EXPECT_TRUE(root->by_id.erase(i * 7));
+    }
+
+    // Read everything back through the second mapping.
+    auto* heap2 = hpc::ipc::shm_heap::attach(reader);
+    ASSERT_NE(heap2, nullptr);
+    auto* root2 = heap2->root<index_root>();
+    ASSERT_NE(root2, nullptr);
+    ASSERT_EQ(root2->prices.size(), 1000u);
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(root2->prices[i], i * 3);
+        const std::uint64_t* v = root2->by_id.find(i * 7);
+        if (i % 2 == 0) {
+            EXPECT_EQ(v, nullptr);
+        } else {
+            ASSERT_NE(v, nullptr);
+            EXPECT_EQ(*v, i);
+        }
+    }
+    EXPECT_EQ(root2->by_id.size(), 500u);
+
+    heap->destroy(root);
+}
+
+TEST(ShmHeap, ReusesFreedBlocks)
+{
+    alignas(64) static unsigned char region[1 << 16];
+    auto* heap = hpc::ipc::shm_heap::create(region, sizeof(region));
+    ASSERT_NE(heap, nullptr);
+    EXPECT_EQ(hpc::ipc::shm_heap::attach(region), heap);
+
+    void* a = heap->allocate(100);
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a) % 64, 0u);
+    const std::size_t carved = heap->carved();
+    heap->deallocate(a, 100);
+    void* b = heap->allocate(120); // same 128-byte class
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(heap->carved(), carved);
+
+    EXPECT_EQ(heap->allocate(1 << 20), nullptr);
+}
+
+TEST(ShmHeap, HonoursAlignmentAboveSize)
+{
+    alignas(64) static unsigned char region[1 << 16];
+    auto* heap = hpc::ipc::shm_heap::create(region, sizeof(region));
+    ASSERT_NE(heap, nullptr);
+
+    void* blocks[16];
+    for (auto& p : blocks) {
+        p = heap->allocate(16, 64);
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 64, 0u);
+    }
+    // Freed with the same alignment, a block is reused for the same request.
+    heap->deallocate(blocks[3], 16, 64);
+    EXPECT_EQ(heap->allocate(16, 64), blocks[3]);
+}
+
+} // namespace
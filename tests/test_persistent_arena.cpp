@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include <hpc/core/persistent_arena.hpp>
+
+namespace {
+
+struct table {
+    std::uint64_t count;
+    hpc::core::persistent_arena::offset_type values; // offset of uint64_t[count]
+};
+
+std::string temp_path(const char* tag)
+{
+    return (std::filesystem::temp_directory_path()
+            / ("hpc_persistent_arena_" + std::string(tag) + "_" + std::to_string(::getpid())))
+        .string();
+}
+
+TEST(PersistentArena, SurvivesRemap)
+{
+    const std::string path = temp_path("remap");
+    std::filesystem::remove(path);
+
+    std::size_t used_before = 0;
+    {
+        hpc::core::persistent_arena a({path, 1 << 20, 7, true});
+        EXPECT_FALSE(a.restored());
+        EXPECT_GE(a.capacity(), std::size_t{1} << 20);
+
+        auto* t = static_cast<table*>(a.allocate(sizeof(table), alignof(table)));
+        ASSERT_NE(t, nullptr);
+        auto* values = static_cast<std::uint64_t*>(a.allocate(100 * sizeof(std::uint64_t), alignof(std::uint64_t)));
+        ASSERT_NE(values, nullptr);
+        for (std::uint64_t i = 0; i < 100; ++i) values[i] = i * i;
+        t->count = 100;
+        t->values = a.to_offset(values);
+        a.set_root(t);
+        used_before = a.used();
+    }
+
+    {
+        hpc::core::persistent_arena a({path, 0, 7, false});
+        EXPECT_TRUE(a.restored());
+        EXPECT_TRUE(a.clean_shutdown());
+        EXPECT_EQ(a.used(), used_before);
+
+        auto* t = a.root<table>();
+        ASSERT_NE(t, nullptr);
+        ASSERT_EQ(t->count, 100u);
+        auto* values = a.from_offset<std::uint64_t>(t->values);
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            EXPECT_EQ(values[i], i * i);
+        }
+
+        // New allocations continue after the restored ones.
+        void* p = a.allocate(64, 64);
+        EXPECT_GE(a.to_offset(p), t->values + 100 * sizeof(std::uint64_t));
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST(PersistentArena, DataStartsOnePageIn)
+{
+    const std::string path = temp_path("offset");
+    std::filesystem::remove(path);
+    const auto page = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+
+    {
+        hpc::core::persistent_arena a({path, 1 << 16, 1, true});
+        void* first = a.allocate(1, 1);
+        ASSERT_NE(first, nullptr);
+        EXPECT_EQ(a.to_offset(first), page);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % page, 0u);
+    }
+    {
+        // The offset is read back from the header.
+        hpc::core::persistent_arena a({path, 0, 1, false});
+        void* next = a.allocate(1, 1);
+        ASSERT_NE(next, nullptr);
+        EXPECT_EQ(a.to_offset(next), page + 1);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST(PersistentArena, RejectsLayoutMismatchAndConcurrentOpen)
+{
+    const std::string path = temp_path("mismatch");
+    std::filesystem::remove(path);
+
+    {
+        hpc::core::persistent_arena a({path, 4096, 1, true});
+        EXPECT_THROW(hpc::core::persistent_arena({path, 4096, 1, true}), std::runtime_error);
+    }
+    EXPECT_THROW(hpc::core::persistent_arena({path, 4096, 2, true}), std::runtime_error);
+
+    std::filesystem::remove(path);
+    EXPECT_THROW(hpc::core::persistent_arena({path, 4096, 1, false}), std::runtime_error);
+}
+
+} // namespace
@@ -2,6 +2,9 @@
 
 #include <hpc/core/pool_allocator.hpp>
 
+#include <cstdint>
+#include <set>
+
 TEST(PoolAllocator, Basic)
 {
     hpc::core::fixed_pool pool(sizeof(int), 4);
@@ -22,3 +25,73 @@ TEST(PoolAllocator, Basic)
     EXPECT_NE(pool.allocate(), nullptr);
 }
 
+
+TEST(PoolAllocator, SlabColoringRotatesOffsets)
+{
+    constexpr std::size_t kElement = 4096;
+    constexpr std::size_t kCount = 64;
+
+    hpc::core::fixed_pool plain(kElement, kCount);
+    hpc::core::fixed_pool colored(kElement, kCount, hpc::core::pool_coloring{1});
+    EXPECT_EQ(colored.storage_bytes(), plain.storage_bytes() + kCount * 64);
+
+    std::set<std::uintptr_t> plain_offsets;
+    std::set<std::uintptr_t> colored_offsets;
+    std::uintptr_t previous = 0;
+    for (std::size_t i = 0; i < kCount; ++i) {
+        plain_offsets.insert(reinterpret_cast<std::uintptr_t>(plain.allocate()) % kElement);
+
+        auto addr = reinterpret_cast<std::uintptr_t>(colored.allocate());
+        EXPECT_EQ(addr % 64, 0u);
+        if (i != 0) {
+            EXPECT_GE(addr, previous + kElement); // no overlap
+        }
+        previous = addr;
+        colored_offsets.insert(addr % kElement);
+    }
+    EXPECT_EQ(plain_offsets.size(), 1u);
+    EXPECT_EQ(colored_offsets.size(), kCount);
+    EXPECT_EQ(colored.allocate(), nullptr);
+}
+
+TEST(PoolAllocator, SlabColoringGroupsElements)
+{
+    hpc::core::fixed_pool pool(256, 8, hpc::core::pool_coloring{4});
+    std::uintptr_t addrs[8];
+    for (auto& a : addrs) {
+        a = reinterpret_cast<std::uintptr_t>(pool.allocate());
+    }
+    EXPECT_EQ(addrs[3] - addrs[0], 3 * 256u);    // same slab: packed
+    EXPECT_EQ(addrs[4] - addrs[3], 256u + 64u);  // next slab: one line further
+}
+
+TEST(PoolAllocator, BulkAllocateAndFree)
+{
+    hpc::core::fixed_pool pool(64, 100);
+
+    void* first[64];
+    EXPECT_EQ(pool.allocate_bulk(first, 64), 64u);
+    void* rest[64];
+    EXPECT_EQ(pool.allocate_bulk(rest, 64), 36u); // runs dry
+    EXPECT_EQ(pool.allocate(), nullptr);
+
+    std::set<void*> distinct(first, first + 64);
+    distinct.insert(rest, rest + 36);
+    EXPECT_EQ(distinct.size(), 100u);
+
+    pool.deallocate_bulk(first, 64);
+    pool.deallocate_bulk(rest, 36);
+    void* again[128];
+    EXPECT_EQ(pool.allocate_bulk(again, 128), 100u);
+    EXPECT_EQ(std::set<void*>(again, again + 100), distinct);
+}
+
+TEST(PoolAllocator, TypedBulk)
+{
+    hpc::core::fixed_pool pool(sizeof(double), 8);
+    hpc::core::pool_allocator<double> alloc(pool);
+    double* objs[8];
+    ASSERT_EQ(alloc.allocate_bulk(objs, 8), 8u);
+    alloc.deallocate_bulk(objs, 8);
+    EXPECT_NE(alloc.allocate(1), nullptr);
+}
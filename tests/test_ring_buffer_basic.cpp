@@ -1,6 +1,54 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <stdexcept>
+
 #include <hpc/core/ring_buffer.hpp>
+#include <hpc/support/cache_line.hpp>
+
+// Counts live objects; move assignment throws when moves_left hits zero.
+struct throwing_move {
+    static inline int live = 0;
+    static inline int moves_left = -1;
+
+    int value = 0;
+
+    throwing_move(int v = 0) : value(v) { ++live; }
+    throwing_move(const throwing_move& other) : value(other.value) { ++live; }
+    ~throwing_move() { --live; }
+
+    throwing_move& operator=(throwing_move&& other)
+    {
+        if (moves_left-- == 0) throw std::runtime_error("move");
+        value = other.value;
+        return *this;
+    }
+};
+
+TEST(SpscRingBuffer, BatchPopSurvivesThrowingMove)
+{
+    {
+        hpc::core::spsc_ring_buffer<throwing_move> q(8);
+        for (int i = 1; i <= 4; ++i) {
+            ASSERT_TRUE(q.try_push(throwing_move{i}));
+        }
+        throwing_move dst[4];
+        throwing_move::moves_left = 1;
+        EXPECT_THROW(q.try_pop_batch(dst, 4), std::runtime_error);
+        throwing_move::moves_left = -1;
+        EXPECT_EQ(dst[0].value, 1);
+
+        // Element 2 stays at the head; element 1 is gone.
+        EXPECT_EQ(q.size(), 3u);
+        throwing_move out;
+        for (int i = 2; i <= 4; ++i) {
+            ASSERT_TRUE(q.try_pop(out));
+            EXPECT_EQ(out.value, i);
+        }
+        EXPECT_TRUE(q.empty());
+    }
+    EXPECT_EQ(throwing_move::live, 0);
+}
 
 TEST(SpscRingBuffer, BasicPushPop)
 {
@@ -29,3 +77,90 @@ TEST(SpscRingBuffer, BasicPushPop)
 
     EXPECT_TRUE(q.empty());
 }
+
+TEST(SpscRingBuffer, WrapAroundKeepsCapacity)
+{
+    hpc::core::spsc_ring_buffer<int> q(7);
+
+    int value = 0;
+    for (int round = 0; round < 5; ++round) {
+        int pushed = 0;
+        while (q.try_push(round * 100 + pushed)) {
+            ++pushed;
+        }
+        EXPECT_EQ(static_cast<std::size_t>(pushed), q.capacity());
+        EXPECT_TRUE(q.full());
+
+        // Leave a partial backlog so the next round starts mid-ring.
+        for (int i = 0; i < pushed - 2; ++i) {
+            ASSERT_TRUE(q.try_pop(value));
+            EXPECT_EQ(value, round * 100 + i);
+        }
+        ASSERT_TRUE(q.try_pop(value));
+        ASSERT_TRUE(q.try_pop(value));
+        EXPECT_TRUE(q.empty());
+    }
+}
+
+TEST(SpscRingBuffer, DrainWithPrefetch)
+{
+    hpc::core::spsc_ring_buffer<int> q(64);
+
+    int next = 0;
+    int expected = 0;
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 40; ++i) {
+            ASSERT_TRUE(q.try_push(next++));
+        }
+
+        std::size_t drained = q.drain([&](int& v) { EXPECT_EQ(v, expected++); }, 25, 8);
+        EXPECT_EQ(drained, 25u);
+        drained = q.drain([&](int& v) { EXPECT_EQ(v, expected++); }, 100, 0);
+        EXPECT_EQ(drained, 15u);
+        EXPECT_TRUE(q.empty());
+    }
+    EXPECT_EQ(q.drain([](int&) {}), 0u);
+}
+
+TEST(SpscRingBuffer, StreamingPush)
+{
+    struct alignas(64) big_message {
+        std::uint64_t seq;
+        std::uint8_t payload[248];
+    };
+
+    hpc::core::spsc_ring_buffer<big_message> q(15);
+
+    big_message batch[20]{};
+    for (std::uint64_t i = 0; i < 20; ++i) {
+        batch[i].seq = i;
+        batch[i].payload[0] = static_cast<std::uint8_t>(i);
+        batch[i].payload[247] = static_cast<std::uint8_t>(i + 1);
+    }
+
+    EXPECT_TRUE(q.try_push_streaming(batch[0]));
+    EXPECT_EQ(q.try_push_batch_streaming(batch + 1, 19), q.capacity() - 1);
+    EXPECT_TRUE(q.full());
+
+    std::uint64_t expected = 0;
+    q.drain([&](big_message& m) {
+        EXPECT_EQ(m.seq, expected);
+        EXPECT_EQ(m.payload[0], static_cast<std::uint8_t>(expected));
+        EXPECT_EQ(m.payload[247], static_cast<std::uint8_t>(expected + 1));
+        ++expected;
+    });
+    EXPECT_EQ(expected, q.capacity());
+}
+
+TEST(CacheLine, RuntimeLineSizeIsPlausible)
+{
+    const std::size_t line = hpc::support::runtime_cache_line_size();
+    if (line == 0) {
+        GTEST_SKIP() << "line size not reported on this platform";
+    }
+    EXPECT_EQ(line & (line - 1), 0u);
+    EXPECT_GE(line, 32u);
+    EXPECT_LE(line, 256u);
+    // A build tuned for this machine pads indices at least one line apart.
+    EXPECT_GE(hpc::support::destructive_interference_size, hpc::support::cache_line_size);
+}
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+
+#include <hpc_schema/test_schema.hpp> // generated from test_schema.json
+
+namespace {
+
+using hpc::test_schema::Quote;
+
+TEST(SchemaCodegen, ExplicitPaddingAndAlignment)
+{
+    // Offsets are also pinned by static_asserts in the generated header.
+    EXPECT_EQ(offsetof(Quote, instrument), 0u);
+    EXPECT_EQ(offsetof(Quote, side), 4u);
+    EXPECT_EQ(offsetof(Quote, price), 8u);
+    EXPECT_EQ(offsetof(Quote, qty), 16u);
+    EXPECT_EQ(offsetof(Quote, symbol), 20u);
+    EXPECT_EQ(sizeof(Quote), 64u);
+    EXPECT_EQ(alignof(Quote), 64u);
+}
+
+TEST(SchemaCodegen, ReadsRecordInPlace)
+{
+    alignas(Quote) unsigned char raw[sizeof(Quote)]{};
+    const double price = 101.25;
+    std::memcpy(raw + 8, &price, sizeof(price));
+    raw[4] = 1;
+
+    const auto* q = reinterpret_cast<const Quote*>(raw);
+    EXPECT_EQ(q->side, 1u);
+    EXPECT_EQ(q->price, price);
+}
+
+} // namespace
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <hpc/core/sequencer.hpp>
+
+namespace {
+
+TEST(Sequencer, ReadsInClaimOrderDespitePublishOrder)
+{
+    hpc::core::sequencer<int> seq(8);
+    const auto a = seq.claim();
+    const auto b = seq.claim();
+    const auto c = seq.claim();
+    EXPECT_EQ(a, 0u);
+    EXPECT_EQ(b, 1u);
+    EXPECT_EQ(c, 2u);
+
+    ::new (seq.slot(c)) int(30);
+    seq.publish(c);
+    ::new (seq.slot(b)) int(20);
+    seq.publish(b);
+
+    // Sequence 0 is still missing, so nothing may be read yet.
+    EXPECT_EQ(seq.drain([](std::uint64_t, int&) {}), 0u);
+    EXPECT_EQ(seq.next_sequence(), 0u);
+
+    ::new (seq.slot(a)) int(10);
+    seq.publish(a);
+
+    std::vector<int> values;
+    EXPECT_EQ(seq.drain([&](std::uint64_t s, int& v) {
+        EXPECT_EQ(static_cast<std::uint64_t>(v), (s + 1) * 10);
+        values.push_back(v);
+    }), 3u);
+    EXPECT_EQ(values, (std::vector<int>{10, 20, 30}));
+    EXPECT_EQ(seq.next_sequence(), 3u);
+}
+
+TEST(Sequencer, TryPushRespectsCapacity)
+{
+    hpc::core::sequencer<int> seq(4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(seq.try_push(i));
+    }
+    EXPECT_FALSE(seq.try_push(4));
+
+    std::uint64_t first = 0;
+    EXPECT_FALSE(seq.try_claim(first, 2));
+
+    int out = -1;
+    ASSERT_TRUE(seq.try_pop(out));
+    EXPECT_EQ(out, 0);
+    EXPECT_TRUE(seq.try_push(4));
+
+    std::vector<int> rest;
+    seq.drain([&](std::uint64_t, int& v) { rest.push_back(v); });
+    EXPECT_EQ(rest, (std::vector<int>{1, 2, 3, 4}));
+}
+
+// A throwing constructor would leave a claimed sequence unpublished and stall
+// the stream, so the constructing producers are not offered for such types.
+struct throwing_ctor {
+    explicit throwing_ctor(int v) : value(v) {}
+    throwing_ctor(const throwing_ctor& other) : value(other.value) {}
+    throwing_ctor& operator=(const throwing_ctor&) = default;
+    int value;
+};
+
+template <class S, class... Args>
+concept can_emplace = requires(S& s, Args&&... args) { s.emplace(std::forward<Args>(args)...); };
+
+template <class S, class V>
+concept can_try_push = requires(S& s, V&& v) { s.try_push(std::forward<V>(v)); };
+
+static_assert(!can_emplace<hpc::core::sequencer<throwing_ctor>, int>);
+static_assert(!can_try_push<hpc::core::sequencer<throwing_ctor>, const throwing_ctor&>);
+static_assert(can_emplace<hpc::core::sequencer<int>, int>);
+static_assert(can_try_push<hpc::core::sequencer<int>, int>);
+
+struct throwing_move {
+    static inline int moves_left = -1;
+    int value = 0;
+    throwing_move(int v = 0) noexcept : value(v) {}
+    throwing_move(throwing_move&& other) noexcept : value(other.value) {}
+    throwing_move& operator=(throwing_move&& other)
+    {
+        if (moves_left-- == 0) throw std::runtime_error("move");
+        value = other.value;
+        return *this;
+    }
+};
+
+TEST(Sequencer, ThrowingConsumerKeepsStreamIntact)
+{
+    hpc::core::sequencer<throwing_move> seq(4);
+    for (int i = 1; i <= 3; ++i) {
+        ASSERT_TRUE(seq.try_push(throwing_move{i}));
+    }
+
+    std::vector<int> seen;
+    throwing_move::moves_left = 1;
+    throwing_move out;
+    EXPECT_THROW(seq.drain([&](std::uint64_t, throwing_move& v) {
+        out = std::move(v);
+        seen.push_back(out.value);
+    }), std::runtime_error);
+    throwing_move::moves_left = -1;
+    EXPECT_EQ(seen, (std::vector<int>{1}));
+    EXPECT_EQ(seq.next_sequence(), 1u);
+
+    // Sequence 1 is read again and the stream continues past it.
+    ASSERT_TRUE(seq.try_push(throwing_move{4}));
+    for (int i = 2; i <= 4; ++i) {
+        ASSERT_TRUE(seq.try_pop(out));
+        EXPECT_EQ(out.value, i);
+    }
+}
+
+TEST(Sequencer, BatchClaim)
+{
+    hpc::core::sequencer<int> seq(16);
+    seq.emplace(0);
+    const auto first = seq.claim(3);
+    EXPECT_EQ(first, 1u);
+    for (std::size_t i = 0; i < 3; ++i) {
+        ::new (seq.slot(first + i)) int(static_cast<int>(first + i));
+    }
+    seq.publish(first, 3);
+    EXPECT_EQ(seq.emplace(4), 4u);
+
+    int expected = 0;
+    EXPECT_EQ(seq.drain([&](std::uint64_t, int& v) { EXPECT_EQ(v, expected++); }), 5u);
+}
+
+TEST(Sequencer, ConcurrentProducersAreGapFree)
+{
+    struct event {
+        std::uint32_t producer;
+        std::uint32_t local;
+    };
+
+    constexpr std::uint32_t kProducers = 4;
+    constexpr std::uint32_t kPerProducer = 50000;
+    hpc::core::sequencer<event> seq(256);
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p]() {
+            for (std::uint32_t i = 0; i < kPerProducer; ++i) {
+                seq.emplace(event{p, i});
+            }
+        });
+    }
+
+    std::vector<std::uint32_t> next_local(kProducers, 0);
+    std::uint64_t expected_seq = 0;
+    while (expected_seq < std::uint64_t{kProducers} * kPerProducer) {
+        const std::size_t n = seq.drain([&](std::uint64_t s, event& e) {
+            EXPECT_EQ(s, expected_seq);
+            ++expected_seq;
+            // Each producer's events stay in its own program order.
+            EXPECT_EQ(e.local, next_local[e.producer]);
+            ++next_local[e.producer];
+        });
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    EXPECT_EQ(seq.claimed(), expected_seq);
+}
+
+} // namespace
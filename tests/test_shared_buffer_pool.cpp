@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <hpc/core/ring_buffer.hpp>
+#include <hpc/core/shared_buffer_pool.hpp>
+
+#include <cstring>
+#include <deque>
+#include <thread>
+#include <vector>
+
+using hpc::core::buffer_handle;
+using hpc::core::shared_buffer_pool;
+
+static_assert(sizeof(buffer_handle) == 8);
+
+TEST(SharedBufferPool, AllocateAndReleaseOnOwner)
+{
+    shared_buffer_pool pool(100, 2);
+    EXPECT_EQ(pool.buffer_size(), 128u);
+    EXPECT_EQ(pool.available(), 2u);
+
+    buffer_handle a = pool.allocate();
+    buffer_handle b = pool.allocate();
+    ASSERT_TRUE(a);
+    ASSERT_TRUE(b);
+    EXPECT_NE(a.data(), b.data());
+    EXPECT_FALSE(pool.allocate()); // exhausted
+
+    shared_buffer_pool::release(a);
+    EXPECT_EQ(pool.available(), 1u);
+    buffer_handle c = pool.allocate();
+    EXPECT_EQ(c, a);
+    shared_buffer_pool::release(b);
+    shared_buffer_pool::release(c);
+    EXPECT_EQ(pool.available(), 2u);
+}
+
+TEST(SharedBufferPool, BatchedRefcounts)
+{
+    shared_buffer_pool pool(64, 1);
+
+    buffer_handle h = pool.allocate(3);
+    shared_buffer_pool::retain(h, 2);
+    shared_buffer_pool::release(h, 4);
+    EXPECT_EQ(pool.available(), 0u);
+
+    // Runs of the same handle fold into one decrement.
+    const buffer_handle last[] = {h};
+    shared_buffer_pool::release(last);
+    EXPECT_EQ(pool.available(), 1u);
+
+    buffer_handle x = pool.allocate(2);
+    const buffer_handle both[] = {x, x};
+    shared_buffer_pool::release(both);
+    EXPECT_EQ(pool.available(), 1u);
+}
+
+TEST(SharedBufferPool, BulkAllocateAndRemoteBatchRelease)
+{
+    shared_buffer_pool pool(256, 32);
+
+    buffer_handle handles[40];
+    EXPECT_EQ(pool.allocate_bulk(handles, 40, 2), 32u);
+    EXPECT_EQ(pool.available(), 0u);
+
+    // First reference dropped locally; buffers stay allocated.
+    shared_buffer_pool::release(std::span<const buffer_handle>(handles, 32));
+    EXPECT_EQ(pool.available(), 0u);
+
+    // The final references go on another thread and come back as one chain.
+    std::thread([&] { shared_buffer_pool::release(std::span<const buffer_handle>(handles, 32)); }).join();
+    EXPECT_EQ(pool.available(), 32u);
+    EXPECT_EQ(pool.allocate_bulk(handles, 40), 32u);
+}
+
+TEST(SharedBufferPool, FanOutReturnsToOwner)
+{
+    constexpr std::size_t kConsumers = 3;
+    constexpr std::uint32_t kMessages = 20000;
+
+    shared_buffer_pool pool(1024, 16);
+    std::deque<hpc::core::spsc_ring_buffer<buffer_handle>> rings;
+    for (std::size_t i = 0; i < kConsumers; ++i) {
+        rings.emplace_back(8);
+    }
+
+    std::vector<std::thread> consumers;
+    std::vector<std::uint64_t> errors(kConsumers, 0);
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        consumers.emplace_back([&, c] {
+            buffer_handle h;
+            for (std::uint32_t expected = 0; expected < kMessages;) {
+                if (!rings[c].try_pop(h)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                std::uint32_t seq;
+                std::memcpy(&seq, h.data(), sizeof(seq));
+                if (seq != expected || h.size() != 1024) {
+                    ++errors[c];
+                }
+                shared_buffer_pool::release(h);
+                ++expected;
+            }
+        });
+    }
+
+    for (std::uint32_t seq = 0; seq < kMessages; ++seq) {
+        buffer_handle h;
+        while (!(h = pool.allocate(kConsumers))) {
+            std::this_thread::yield();
+        }
+        std::memcpy(h.data(), &seq, sizeof(seq));
+        h.set_size(1024);
+        for (auto& ring : rings) {
+            while (!ring.try_push(h)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    for (auto& t : consumers) {
+        t.join();
+    }
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        EXPECT_EQ(errors[c], 0u);
+    }
+    EXPECT_EQ(pool.available(), pool.capacity());
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <hpc/core/spsc_merge_consumer.hpp>
+
+namespace {
+
+struct tick {
+    std::uint64_t ts;
+    std::uint32_t feed;
+};
+
+struct tick_time {
+    std::uint64_t operator()(const tick& t) const noexcept { return t.ts; }
+};
+
+using ring = hpc::core::spsc_ring_buffer<tick>;
+using merger = hpc::core::spsc_merge_consumer<tick, tick_time>;
+
+TEST(SpscMergeConsumer, MergesInTimestampOrder)
+{
+    ring a(16), b(16), c(16);
+    ring* rings[] = {&a, &b, &c};
+
+    for (std::uint64_t ts : {1, 4, 7, 10}) a.try_push({ts, 0});
+    for (std::uint64_t ts : {2, 4, 8, 11}) b.try_push({ts, 1});
+    for (std::uint64_t ts : {3, 5, 9, 12}) c.try_push({ts, 2});
+
+    merger m(rings, 0);
+    std::vector<std::uint64_t> order;
+    std::vector<std::uint32_t> feeds;
+    const std::size_t n = m.drain([&](std::size_t idx, tick& t) {
+        EXPECT_EQ(idx, t.feed);
+        order.push_back(t.ts);
+        feeds.push_back(t.feed);
+    });
+
+    EXPECT_EQ(n, 12u);
+    EXPECT_EQ(order, (std::vector<std::uint64_t>{1, 2, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12}));
+    // Equal timestamps are taken from the lower ring index first.
+    EXPECT_EQ(feeds[3], 0u);
+    EXPECT_EQ(feeds[4], 1u);
+    EXPECT_TRUE(a.empty() && b.empty() && c.empty());
+    EXPECT_EQ(m.late_count(), 0u);
+}
+
+TEST(SpscMergeConsumer, WaitsForEmptyRingsWithinWindow)
+{
+    ring a(16), b(16);
+    ring* rings[] = {&a, &b};
+
+    a.try_push({100, 0});
+    a.try_push({200, 0});
+
+    merger strict(rings);
+    EXPECT_EQ(strict.peek(), nullptr);
+    strict.advance_watermark(1000);
+    EXPECT_EQ(strict.peek(), nullptr);
+
+    merger m(rings, 50);
+    EXPECT_EQ(m.peek(), nullptr); // b may still deliver something older
+    m.advance_watermark(149);
+    EXPECT_EQ(m.peek(), nullptr);
+    m.advance_watermark(150);
+    ASSERT_NE(m.peek(), nullptr);
+    EXPECT_EQ(m.peek()->ts, 100u);
+    m.pop();
+
+    // A late element on b is delivered next and counted.
+    b.try_push({120, 1});
+    std::size_t idx = 0;
+    tick* t = m.peek(&idx);
+    ASSERT_NE(t, nullptr);
+    EXPECT_EQ(idx, 1u);
+    EXPECT_EQ(t->ts, 120u);
+    m.pop();
+    EXPECT_EQ(m.late_count(), 0u);
+
+    b.try_push({90, 1});
+    t = m.peek(&idx);
+    ASSERT_NE(t, nullptr);
+    EXPECT_EQ(t->ts, 90u);
+    m.pop();
+    EXPECT_EQ(m.late_count(), 1u);
+}
+
+TEST(SpscMergeConsumer, RefillsRingsThatRunDryAndReturn)
+{
+    ring a(16), b(16), c(16), d(16), e(16);
+    ring* rings[] = {&a, &b, &c, &d, &e};
+    merger m(rings, 0);
+
+    // Each round only some feeds have data; the others must be picked up
+    // again once they deliver.
+    std::vector<std::uint64_t> order;
+    const auto take = [&](std::size_t, tick& t) { order.push_back(t.ts); };
+    c.try_push({3, 2});
+    a.try_push({1, 0});
+    EXPECT_EQ(m.drain(take), 2u);
+    e.try_push({6, 4});
+    b.try_push({5, 1});
+    d.try_push({4, 3});
+    EXPECT_EQ(m.drain(take), 3u);
+    EXPECT_EQ(m.drain(take), 0u);
+    a.try_push({8, 0});
+    e.try_push({7, 4});
+    EXPECT_EQ(m.drain(take), 2u);
+
+    EXPECT_EQ(order, (std::vector<std::uint64_t>{1, 3, 4, 5, 6, 7, 8}));
+    EXPECT_EQ(m.late_count(), 0u);
+}
+
+TEST(SpscMergeConsumer, ConcurrentFeeds)
+{
+    constexpr std::size_t kFeeds = 5;
+    constexpr std::uint64_t kPerFeed = 20000;
+    std::vector<std::unique_ptr<ring>> storage;
+    std::vector<ring*> rings;
+    for (std::size_t i = 0; i < kFeeds; ++i) {
+        storage.push_back(std::make_unique<ring>(64));
+        rings.push_back(storage.back().get());
+    }
+
+    std::vector<std::thread> producers;
+    for (std::uint32_t f = 0; f < kFeeds; ++f) {
+        producers.emplace_back([&, f]() {
+            for (std::uint64_t i = 0; i < kPerFeed; ++i) {
+                while (!rings[f]->try_push({i * kFeeds + f, f})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // In wait-for-all mode the merge can run until feed 0 is exhausted.
+    merger m(rings);
+    std::uint64_t expected = 0;
+    while (expected < (kPerFeed - 1) * kFeeds + 1) {
+        m.drain([&](std::size_t, tick& t) {
+            EXPECT_EQ(t.ts, expected);
+            ++expected;
+        });
+    }
+    for (auto& p : producers) {
+        p.join();
+    }
+    EXPECT_EQ(m.peek(), nullptr);
+    EXPECT_EQ(m.late_count(), 0u);
+}
+
+} // namespace
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <hpc/core/spsc_ring_group.hpp>
+
+namespace {
+
+TEST(SpscRingGroup, VisitsOnlyActiveRings)
+{
+    hpc::core::spsc_ring_group<int> group(2000, 16);
+    EXPECT_EQ(group.active_count(), 0u);
+
+    ASSERT_TRUE(group.try_push(3, 30));
+    ASSERT_TRUE(group.try_push(3, 31));
+    ASSERT_TRUE(group.try_push(700, 7000));
+    ASSERT_TRUE(group.try_push(1999, 19990));
+    EXPECT_EQ(group.active_count(), 3u);
+
+    std::vector<std::pair<std::size_t, int>> seen;
+    const std::size_t n = group.poll([&](std::size_t ring, int& v) { seen.emplace_back(ring, v); });
+    EXPECT_EQ(n, 4u);
+    ASSERT_EQ(seen.size(), 4u);
+    EXPECT_EQ(seen[0], (std::pair<std::size_t, int>{3, 30}));
+    EXPECT_EQ(seen[1], (std::pair<std::size_t, int>{3, 31}));
+    EXPECT_EQ(seen[2], (std::pair<std::size_t, int>{700, 7000}));
+    EXPECT_EQ(seen[3], (std::pair<std::size_t, int>{1999, 19990}));
+
+    EXPECT_EQ(group.active_count(), 0u);
+    EXPECT_EQ(group.poll([](std::size_t, int&) {}), 0u);
+}
+
+TEST(SpscRingGroup, PartialDrainStaysActive)
+{
+    hpc::core::spsc_ring_group<int> group(64, 16);
+    const int values[] = {1, 2, 3, 4, 5};
+    ASSERT_EQ(group.try_push_batch(10, values, 5), 5u);
+
+    int sum = 0;
+    EXPECT_EQ(group.poll([&](std::size_t, int& v) { sum += v; }, 2), 2u);
+    EXPECT_EQ(sum, 3);
+    EXPECT_EQ(group.active_count(), 1u);
+
+    EXPECT_EQ(group.poll([&](std::size_t, int& v) { sum += v; }), 3u);
+    EXPECT_EQ(sum, 15);
+    EXPECT_EQ(group.active_count(), 0u);
+}
+
+TEST(SpscRingGroup, ConcurrentProducers)
+{
+    constexpr std::size_t kRings = 600;
+    constexpr std::size_t kProducers = 4;
+    constexpr std::uint64_t kPerRing = 500;
+    hpc::core::spsc_ring_group<std::uint64_t> group(kRings, 32);
+
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p]() {
+            // Each producer owns a disjoint, interleaved subset of rings.
+            for (std::uint64_t seq = 0; seq < kPerRing; ++seq) {
+                for (std::size_t r = p; r < kRings; r += kProducers) {
+                    while (!group.try_push(r, seq)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+    }
+
+    std::vector<std::uint64_t> next(kRings, 0);
+    std::size_t total = 0;
+    while (total < kRings * kPerRing) {
+        total += group.poll([&](std::size_t ring, std::uint64_t& seq) {
+            EXPECT_EQ(seq, next[ring]);
+            ++next[ring];
+        });
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    EXPECT_EQ(group.active_count(), 0u);
+}
+
+} // namespace
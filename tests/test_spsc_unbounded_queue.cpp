@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include <hpc/core/spsc_unbounded_queue.hpp>
+
+namespace {
+
+TEST(SpscUnboundedQueue, GrowsAcrossSegments)
+{
+    hpc::core::spsc_unbounded_queue<int> q(8, 4);
+    EXPECT_TRUE(q.empty());
+
+    for (int i = 0; i < 100; ++i) {
+        q.push(i);
+    }
+    EXPECT_GE(q.segments_allocated(), 100u / 8);
+
+    int value = -1;
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(q.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(q.try_pop(value));
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscUnboundedQueue, RecyclesDrainedSegments)
+{
+    hpc::core::spsc_unbounded_queue<int> q(16, 4, 2);
+    const std::size_t initial = q.segments_allocated();
+    EXPECT_EQ(initial, 3u);
+
+    int expected = 0;
+    int next = 0;
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 40; ++i) {
+            q.push(next++);
+        }
+        std::size_t drained = q.drain([&](int& v) { EXPECT_EQ(v, expected++); }, 25);
+        EXPECT_EQ(drained, 25u);
+        drained = q.drain([&](int& v) { EXPECT_EQ(v, expected++); });
+        EXPECT_EQ(drained, 15u);
+    }
+    // A consumer that keeps up lets the producer reuse pooled segments.
+    EXPECT_LE(q.segments_allocated(), initial + 2);
+}
+
+TEST(SpscUnboundedQueue, DestroysRemainingElements)
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        hpc::core::spsc_unbounded_queue<std::shared_ptr<int>> q(4);
+        for (int i = 0; i < 10; ++i) {
+            q.push(tracker);
+        }
+        std::shared_ptr<int> out;
+        ASSERT_TRUE(q.try_pop(out));
+        EXPECT_EQ(tracker.use_count(), 11);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(SpscUnboundedQueue, ProducerConsumerThreads)
+{
+    constexpr std::uint64_t kCount = 200000;
+    hpc::core::spsc_unbounded_queue<std::uint64_t> q(64, 8);
+
+    std::thread producer([&]() {
+        for (std::uint64_t i = 0; i < kCount; ++i) {
+            q.push(i);
+        }
+    });
+
+    std::uint64_t expected = 0;
+    while (expected < kCount) {
+        q.drain([&](std::uint64_t& v) {
+            EXPECT_EQ(v, expected);
+            ++expected;
+        });
+    }
+    producer.join();
+    EXPECT_TRUE(q.empty());
+}
+
+} // namespace
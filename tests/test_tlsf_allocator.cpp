@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <hpc/core/tlsf_allocator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <utility>
+#include <vector>
+
+using hpc::core::tlsf_allocator;
+
+TEST(TlsfAllocator, AllocateFreeCoalesce)
+{
+    tlsf_allocator tlsf(std::size_t{1} << 20);
+    const std::size_t initial = tlsf.free_bytes();
+    EXPECT_EQ(tlsf.largest_free_block(), initial);
+
+    void* a = tlsf.allocate(1);
+    void* b = tlsf.allocate(1000);
+    void* c = tlsf.allocate(100000);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a) % tlsf_allocator::alignment, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % tlsf_allocator::alignment, 0u);
+    EXPECT_GE(tlsf.block_size(b), 1000u);
+    std::memset(c, 0xab, 100000);
+
+    // Freeing the middle block, then its neighbours, coalesces back to one.
+    tlsf.deallocate(b);
+    tlsf.deallocate(a);
+    tlsf.deallocate(c);
+    EXPECT_EQ(tlsf.free_bytes(), initial);
+    EXPECT_EQ(tlsf.largest_free_block(), initial);
+}
+
+TEST(TlsfAllocator, CallerSuppliedBufferExhaustion)
+{
+    alignas(16) static std::byte buffer[4096];
+    tlsf_allocator tlsf(buffer, sizeof(buffer));
+    EXPECT_LE(tlsf.capacity(), sizeof(buffer));
+    EXPECT_EQ(tlsf.allocate(8192), nullptr);
+    EXPECT_EQ(tlsf.allocate(0), nullptr);
+
+    std::vector<void*> blocks;
+    while (void* p = tlsf.allocate(256)) {
+        auto* bp = static_cast<std::byte*>(p);
+        ASSERT_GE(bp, buffer);
+        ASSERT_LE(bp + 256, buffer + sizeof(buffer));
+        blocks.push_back(p);
+    }
+    EXPECT_GE(blocks.size(), 10u);
+    for (void* p : blocks) {
+        tlsf.deallocate(p);
+    }
+    EXPECT_NE(tlsf.allocate(3000), nullptr);
+}
+
+TEST(TlsfAllocator, RandomizedNoOverlap)
+{
+    tlsf_allocator tlsf(std::size_t{4} << 20);
+    const std::size_t initial = tlsf.free_bytes();
+    std::mt19937 rng(7);
+    std::vector<std::pair<std::byte*, std::size_t>> live;
+
+    for (int step = 0; step < 50000; ++step) {
+        if (!live.empty() && (rng() % 2 == 0 || live.size() > 500)) {
+            const std::size_t i = rng() % live.size();
+            auto [p, size] = live[i];
+            ASSERT_EQ(p[0], static_cast<std::byte>(size & 0xff));
+            tlsf.deallocate(p);
+            live[i] = live.back();
+            live.pop_back();
+            continue;
+        }
+        const std::size_t bytes = std::size_t{1} + rng() % (rng() % 8 == 0 ? 65536u : 512u);
+        auto* p = static_cast<std::byte*>(tlsf.allocate(bytes));
+        if (!p) {
+            continue;
+        }
+        ASSERT_GE(tlsf.block_size(p), bytes);
+        std::memset(p, static_cast<int>(bytes & 0xff), bytes);
+        live.emplace_back(p, bytes);
+    }
+
+    auto sorted = live;
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 1; i < sorted.size(); ++i) {
+        ASSERT_LE(sorted[i - 1].first + sorted[i - 1].second, sorted[i].first);
+    }
+    for (auto& [p, size] : live) {
+        tlsf.deallocate(p);
+    }
+    EXPECT_EQ(tlsf.free_bytes(), initial);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include <unistd.h>
+
+#include <hpc/io/udp_batch.hpp>
+
+namespace {
+
+using datagram = hpc::io::udp_datagram<256>;
+
+TEST(UdpBatch, LoopbackRoundTrip)
+{
+    const int rx = hpc::io::open_udp_socket("127.0.0.1", 0, 1 << 20);
+    const int tx = hpc::io::open_udp_socket("127.0.0.1", 0);
+    hpc::io::connect_udp_socket(tx, "127.0.0.1", hpc::io::local_port(rx));
+
+    hpc::core::spsc_ring_buffer<datagram> outbound(255);
+    hpc::core::spsc_ring_buffer<datagram> inbound(255);
+
+    constexpr std::uint32_t kCount = 200;
+    for (std::uint32_t i = 0; i < kCount; ++i) {
+        datagram* d = outbound.try_acquire_producer_slot();
+        ASSERT_NE(d, nullptr);
+        d->peer_length = 0; // connected socket
+        d->length = 4 + i % 100;
+        std::memset(d->payload, static_cast<int>(i & 0xff), d->length);
+        std::memcpy(d->payload, &i, sizeof(i));
+        outbound.commit_producer_slot();
+    }
+
+    hpc::io::udp_sender<datagram> sender(tx, outbound);
+    hpc::io::udp_receiver<datagram> receiver(rx, inbound);
+
+    std::uint32_t received = 0;
+    for (int spin = 0; spin < 100000 && received < kCount; ++spin) {
+        sender.flush();
+        receiver.poll();
+        while (datagram* d = inbound.try_acquire_consumer_slot()) {
+            std::uint32_t seq = 0;
+            std::memcpy(&seq, d->payload, sizeof(seq));
+            EXPECT_EQ(seq, received);
+            EXPECT_EQ(d->length, 4 + seq % 100);
+            EXPECT_EQ(d->flags & MSG_TRUNC, 0u);
+            EXPECT_EQ(d->peer.sin6_family, AF_INET);
+            inbound.release_consumer_slot();
+            ++received;
+        }
+    }
+
+    EXPECT_EQ(received, kCount);
+    EXPECT_TRUE(outbound.empty());
+    // Batching: far fewer system calls than datagrams.
+    EXPECT_LT(sender.syscalls(), kCount / 2);
+    EXPECT_LT(receiver.syscalls(), kCount / 2);
+    EXPECT_EQ(sender.last_error(), 0);
+    EXPECT_EQ(receiver.last_error(), 0);
+
+    ::close(tx);
+    ::close(rx);
+}
+
+TEST(UdpBatch, TruncatesOversizedDatagrams)
+{
+    using small = hpc::io::udp_datagram<16>;
+    const int rx = hpc::io::open_udp_socket("127.0.0.1", 0);
+    const int tx = hpc::io::open_udp_socket("127.0.0.1", 0);
+    hpc::io::connect_udp_socket(tx, "127.0.0.1", hpc::io::local_port(rx));
+
+    const char big[64] = "this datagram does not fit";
+    ASSERT_EQ(::send(tx, big, sizeof(big), 0), static_cast<ssize_t>(sizeof(big)));
+
+    hpc::core::spsc_ring_buffer<small> ring(7);
+    hpc::io::udp_receiver<small> receiver(rx, ring);
+    std::size_t got = 0;
+    for (int spin = 0; spin < 100000 && got == 0; ++spin) {
+        got = receiver.poll();
+    }
+    ASSERT_EQ(got, 1u);
+    EXPECT_EQ(receiver.truncated(), 1u);
+    small* d = ring.try_acquire_consumer_slot();
+    ASSERT_NE(d, nullptr);
+    EXPECT_NE(d->flags & MSG_TRUNC, 0u);
+    EXPECT_EQ(std::memcmp(d->payload, big, 16), 0);
+
+    ::close(tx);
+    ::close(rx);
+}
+
+} // namespace
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""Generate fixed-layout message definitions from a JSON schema.
+
+Emits a C++ header with POD structs whose field offsets, sizes and alignment
+are pinned by static_asserts, and a Python module with matching NumPy dtypes,
+so both sides can view shared-memory records in place.
+
+Schema format:
+
+    {
+      "namespace": "hpc::examples",
+      "messages": [
+        {
+          "name": "Message",
+          "align": 64,                      # optional, defaults to natural
+          "fields": [
+            {"name": "seq",     "type": "u64"},
+            {"name": "payload", "type": "u8", "count": 48}
+          ]
+        }
+      ]
+    }
+
+Fields are laid out in declaration order at their natural alignment. Gaps
+are filled with explicit padding members, so the generated structs have no
+compiler-inserted padding and the same layout on every conforming ABI. All
+multi-byte fields are little-endian.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+# type -> (size, C++ type, NumPy format)
+TYPES = {
+    "i8": (1, "std::int8_t", "i1"),
+    "u8": (1, "std::uint8_t", "u1"),
+    "i16": (2, "std::int16_t", "<i2"),
+    "u16": (2, "std::uint16_t", "<u2"),
+    "i32": (4, "std::int32_t", "<i4"),
+    "u32": (4, "std::uint32_t", "<u4"),
+    "i64": (8, "std::int64_t", "<i8"),
+    "u64": (8, "std::uint64_t", "<u8"),
+    "f32": (4, "float", "<f4"),
+    "f64": (8, "double", "<f8"),
+    "char": (1, "char", "S1"),
+}
+
+
+class SchemaError(Exception):
+    pass
+
+
+def align_up(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+
+def layout(message):
+    """Return (fields, size, align); fields include explicit padding entries."""
+    name = message["name"]
+    fields = []
+    offset = 0
+    max_align = 1
+    pad_index = 0
+
+    for field in message["fields"]:
+        ftype = field["type"]
+        if ftype not in TYPES:
+            raise SchemaError(f"{name}.{field['name']}: unknown type '{ftype}'")
+        size, cpp_type, np_format = TYPES[ftype]
+        count = int(field.get("count", 1))
+        if count < 1:
+            raise SchemaError(f"{name}.{field['name']}: count must be positive")
+
+        aligned = align_up(offset, size)
+        if aligned != offset:
+            fields.append({"name": f"_pad{pad_index}", "pad": aligned - offset, "offset": offset})
+            pad_index += 1
+        fields.append({
+            "name": field["name"],
+            "cpp_type": cpp_type,
+            "np_format": np_format,
+            "count": count if "count" in field else None,
+            "offset": aligned,
+        })
+        offset = aligned + size * count
+        max_align = max(max_align, size)
+
+    align = int(message.get("align", max_align))
+    if align < max_align or align & (align - 1):
+        raise SchemaError(f"{name}: align must be a power of two >= {max_align}")
+
+    total = align_up(offset, align)
+    if total != offset:
+        fields.append({"name": f"_pad{pad_index}", "pad": total - offset, "offset": offset})
+    return fields, total, align
+
+
+def emit_cpp(schema, source_name, layouts):
+    out = [
+        f"// Generated by tools/hpc_schema_gen.py from {source_name}. Do not edit.",
+        "#pragma once",
+        "",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "#include <type_traits>",
+        "",
+        f"namespace {schema['namespace']} {{",
+    ]
+    for message, (fields, size, align) in zip(schema["messages"], layouts):
+        name = message["name"]
+        natural = max((TYPES[f["type"]][0] for f in message["fields"]), default=1)
+        alignas = f"alignas({align}) " if align != natural else ""
+        out += ["", f"struct {alignas}{name} {{"]
+        for f in fields:
+            if "pad" in f:
+                out.append(f"    std::uint8_t {f['name']}[{f['pad']}];")
+            elif f["count"] is not None:
+                out.append(f"    {f['cpp_type']} {f['name']}[{f['count']}];")
+            else:
+                out.append(f"    {f['cpp_type']} {f['name']};")
+        out += [
+            "};",
+            "",
+            f"static_assert(std::is_standard_layout_v<{name}> && std::is_trivially_copyable_v<{name}>);",
+            f"static_assert(sizeof({name}) == {size});",
+            f"static_assert(alignof({name}) == {align});",
+        ]
+        for f in fields:
+            out.append(f"static_assert(offsetof({name}, {f['name']}) == {f['offset']});")
+    out += ["", f"}} // namespace {schema['namespace']}", ""]
+    return "\n".join(out)
+
+
+def emit_python(schema, source_name, layouts):
+    out = [
+        f'"""Generated by tools/hpc_schema_gen.py from {source_name}. Do not edit."""',
+        "",
+        "import numpy as np",
+    ]
+    for message, (fields, size, _align) in zip(schema["messages"], layouts):
+        const = "".join("_" + c if c.isupper() and i else c for i, c in enumerate(message["name"])).upper()
+        names, formats, offsets = [], [], []
+        for f in fields:
+            if "pad" in f:
+                continue
+            names.append(repr(f["name"]))
+            fmt = f["np_format"] if f["count"] is None else f"({f['count']},){f['np_format']}"
+            formats.append(repr(fmt))
+            offsets.append(str(f["offset"]))
+        out += [
+            "",
+            f"{const}_DTYPE = np.dtype({{",
+            f"    \"names\": [{', '.join(names)}],",
+            f"    \"formats\": [{', '.join(formats)}],",
+            f"    \"offsets\": [{', '.join(offsets)}],",
+            f"    \"itemsize\": {size},",
+            "})",
+            f"{const}_SIZE = {size}",
+        ]
+    out.append("")
+    return "\n".join(out)
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("schema")
+    parser.add_argument("--cpp", required=True, help="output C++ header")
+    parser.add_argument("--python", required=True, help="output Python module")
+    args = parser.parse_args(argv)
+
+    with open(args.schema, encoding="utf-8") as f:
+        schema = json.load(f)
+
+    source_name = os.path.basename(args.schema)
+    try:
+        layouts = [layout(m) for m in schema["messages"]]
+    except SchemaError as ex:
+        print(f"{source_name}: {ex}", file=sys.stderr)
+        return 1
+
+    for path, text in ((args.cpp, emit_cpp(schema, source_name, layouts)),
+                       (args.python, emit_python(schema, source_name, layouts))):
+        os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(text)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))